@@ -722,6 +722,8 @@
   #define MPC_SMOOTHING_FACTOR 0.5f                   // (0.0...1.0) Noisy temperature sensors may need a lower value for stabilization.
   #define MPC_MIN_AMBIENT_CHANGE 1.0f                 // (K/s) Modeled ambient temperature rate of change, when correcting model inaccuracies.
   #define MPC_STEADYSTATE 0.5f                        // (K/s) Temperature change rate for steady state logic to be enforced.
+  //#define MPC_FEEDFORWARD_LEAD 1.0f                 // (s) Plan heater power for the extrusion rate this far ahead in the planner queue,
+                                                      //     so power rises before a fast section starts instead of after the nozzle cools.
 
   #define MPC_TUNING_POS { X_CENTER, Y_CENTER, 1.0f } // (mm) M306 Autotuning position, ideally bed center at first layer height.
   #define MPC_TUNING_END_Z 10.0f                      // (mm) M306 Autotuning final Z position.
@@ -1990,6 +1992,15 @@
   #define LEVELING_BED_TEMP     50
 #endif
 
+/**
+ * Plan the order of the points probed by G29 and printed by G26 for the least
+ * travel time, given the XY feedrate and the axis acceleration limits. The path
+ * starts along a Hilbert curve and is shortened by local improvements (2-opt).
+ * The estimated travel time and saving are reported after probing.
+ * Uses 2 bytes of SRAM per mesh point.
+ */
+//#define PROBE_PATH_PLANNER
+
 /**
  * Bed Distance Sensor
  *
@@ -2030,6 +2041,13 @@
   #define SEGMENT_LEVELED_MOVES
   #define LEVELED_SEGMENT_LENGTH 5.0 // (mm) Length of all segments (except the last one)
 
+  /**
+   * Interpolate the mesh with bicubic patches instead of straight lines between the points.
+   * Gives the smooth Catmull-Rom surface of ABL_BILINEAR_SUBDIVISION, without the subdivided
+   * grid, using 12 bytes of RAM per mesh point. For AUTO_BED_LEVELING_BILINEAR and UBL.
+   */
+  //#define MESH_BICUBIC
+
   /**
    * Enable the G26 Mesh Validation Pattern tool.
    */
@@ -2071,6 +2089,24 @@
       #define BILINEAR_SUBDIVISIONS 3
     #endif
 
+    //
+    // Keep the interpolation coefficients of every grid box in RAM for faster
+    // leveling corrections.
+    // Uses 16 bytes of RAM per grid box (per subdivided box with ABL_BILINEAR_SUBDIVISION).
+    //
+    //#define ABL_BILINEAR_BOX_CACHE
+
+    //
+    // Adaptive probe density for G29. Probe a coarse grid first, then probe the points
+    // between only where the bed strays from a plane by more than the tolerance. The
+    // points not probed are interpolated, so a bump narrower than the coarse grid can be
+    // missed. Use 'G29 U<mm>' to set the tolerance for one run, or 'G29 U0' to probe every point.
+    //
+    //#define G29_ADAPTIVE_PROBING
+    #if ENABLED(G29_ADAPTIVE_PROBING)
+      #define G29_ADAPTIVE_TOLERANCE 0.02 // (mm)
+    #endif
+
   #endif
 
 #elif ENABLED(AUTO_BED_LEVELING_UBL)
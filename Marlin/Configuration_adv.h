@@ -169,6 +169,14 @@
   #define REDUNDANT_SH_C_COEFF               0 // Steinhart-Hart C coefficient
 #endif
 
+/**
+ * Convert Custom Thermistor 1000 readings with a lookup table in RAM instead of evaluating
+ * the Steinhart-Hart equation each time. The table is rebuilt when M305 changes the parameters,
+ * with entries placed where the curve bends most. It covers -20°C to 999°C, and with 64 entries
+ * it is within 1°C or one ADC step of the equation. Uses 4 bytes of RAM per entry per thermistor.
+ */
+//#define USER_THERMISTOR_TABLE_SIZE 64  // (16-128) Table entries per custom thermistor
+
 /**
  * Thermocouple Options — for MAX6675 (-2), MAX31855 (-3), and MAX31865 (-5).
  */
@@ -498,6 +506,20 @@
 // Enable for M105 to include ADC values read from temperature sensors.
 //#define SHOW_TEMP_ADC_VALUES
 
+/**
+ * ADC DMA Ring
+ * Let the ADC scan all temperature sensors continuously into a DMA ring buffer.
+ * The temperature ISR no longer starts and reads one sensor per call. It just adds up
+ * the buffered samples, so temperatures update faster and the ISR does less work.
+ * PID_K1, MPC_SMOOTHING_FACTOR and MAX_CONSECUTIVE_LOW_TEMPERATURE_ERROR_ALLOWED are per update
+ * at the classic rate, and are scaled to act over the same time. Periods in seconds are unchanged.
+ * Supported on STM32F1 (maple) and the Linux simulator.
+ */
+//#define ADC_DMA_RING
+#if ENABLED(ADC_DMA_RING)
+  #define ADC_RING_UPDATE_LOOPS 4   // (1-16) Sensor rounds (~10ms each) per temperature update. 16 matches the classic rate.
+#endif
+
 /**
  * High Temperature Thermistor Support
  *
@@ -528,6 +550,21 @@
 //#define PREHEAT_TIME_HOTEND_MS 0
 //#define PREHEAT_TIME_BED_MS 0
 
+/**
+ * Heater Power Budget
+ * Keep the total power drawn by the heaters under a limit, so the power supply doesn't
+ * need to cover every heater at full power. Each heater's PWM cycle is given a start phase
+ * so heaters that don't fit the budget together are never on at the same time.
+ * Heaters holding their target are served first, then the ones needing the most heat to reach it.
+ * M105 and temperature auto-reports add "PWR:granted/requested" watts.
+ */
+//#define HEATER_POWER_BUDGET 300             // (W) Limit for all heaters together
+#ifdef HEATER_POWER_BUDGET
+  #define HOTEND_HEATER_WATTS { 40 }          // (W) Power of each hotend heater
+  #define BED_HEATER_WATTS      250           // (W)
+  #define CHAMBER_HEATER_WATTS  200           // (W)
+#endif
+
 // @section extruder
 
 /**
@@ -1147,7 +1184,28 @@
 
   // This value may be configured to adjust duration to consume the command buffer.
   // Try increasing this value if stepper motion is not smooth.
-  #define FTM_STEPPERCMD_BUFF_SIZE 1000                 // Size of the stepper command buffers.
+  #define FTM_STEPPERCMD_BUFF_SIZE 2500                 // Size of the stepper command buffer. (2 bytes per command)
+
+  /**
+   * Generate stepper commands in the temperature ISR instead of idle(), so motion continues
+   * while the main loop is blocked (e.g., by a slow SD read or display update). The stepper
+   * ISR still preempts it. Each ISR call makes at most 3 trajectory points (3ms of motion at
+   * the default FTM_FS) and their stepper commands, and shapes them as they're made, so the
+   * call stays well under the temperature ISR period. M493 reports stepper buffer underruns.
+   */
+  //#define FTM_TIMER_TASK
+
+  /**
+   * S-curve (jerk-limited) acceleration. Each acceleration and deceleration ramps up, holds,
+   * and ramps down in a 7-segment profile, exciting less resonance for the shaper to cancel.
+   * Each phase keeps the time and distance of the planner's trapezoid, so junction speeds and
+   * timing are unchanged, and the peak acceleration rises by up to 2x. The ramps are kept as
+   * short as the axis jerk limits allow, or the whole phase is an S if it's too short.
+   */
+  //#define FTM_SCURVE
+  #if ENABLED(FTM_SCURVE)
+    #define FTM_MAX_JERK { 1000000, 1000000, 20000, 2000000 } // (mm/s^3) Max jerk for X, Y, Z, E...
+  #endif
 
   //#define FT_MOTION_MENU                              // Provide a MarlinUI menu to set M493 parameters.
 #endif
@@ -1255,6 +1313,14 @@
 // if unwanted behavior is observed on a user's machine when running at very slow speeds.
 #define MINIMUM_PLANNER_SPEED 0.05 // (mm/s)
 
+/**
+ * Fixed-Point Planner
+ * Plan junction speeds and acceleration ramps with integer math instead of
+ * float. Faster on 32-bit boards without an FPU (e.g., STM32F1, LPC1768).
+ * Speeds are limited to 2047mm/s. Not recommended for boards with an FPU.
+ */
+//#define PLANNER_FIXED_POINT
+
 //
 // Backlash Compensation
 // Adds extra movement to axes on direction-changes to account for backlash.
@@ -1855,8 +1921,28 @@
   #if ENABLED(BINARY_FILE_TRANSFER)
     // Include extra facilities (e.g., 'M20 F') supporting firmware upload via BINARY_FILE_TRANSFER
     //#define CUSTOM_FIRMWARE_UPLOAD
+
+    // Let the host send several packets before waiting for an 'ok', so transfers aren't limited by the
+    // serial round-trip time. Packets that arrive after a lost or corrupt one are held until it's resent.
+    //#define BINARY_STREAM_WINDOW 4  // (2-16) Packets in flight. Each one after the first uses MAX_CMD_SIZE bytes of RAM.
   #endif
 
+  /**
+   * Print heatshrink-compressed G-code files (e.g., 'part.gcode.hs', DOS extension '.HS')
+   * directly from the media, decompressing on the fly. This cuts media reads and file
+   * transfer time. Compress with 'buildroot/share/scripts/heatshrink_gcode.py', which uses the
+   * decoder's fixed 256 byte window (window 8, lookahead 4). Uses about 340 bytes of RAM.
+   */
+  //#define HEATSHRINK_GCODE
+
+  /**
+   * Read the printing file ahead into a ring of 512 byte blocks. SPI cards fill it with multiple
+   * block reads, while SDIO and USB media read one block at a time. The ring is topped up while
+   * the command queue is full, so the planner is less likely to starve on a slow card.
+   * 'M27 R' reports hits, misses, and time spent waiting for the media.
+   */
+  //#define SD_READ_AHEAD_BLOCKS 4  // (2-16) Blocks to read ahead. Uses 512 bytes of RAM per block.
+
   /**
    * Set this option to one of the following (or the board's defaults apply):
    *
@@ -2416,6 +2502,20 @@
   #define N_ARC_CORRECTION       25   // Number of interpolated segments between corrections
   //#define ARC_P_CIRCLES             // Enable the 'P' parameter to specify complete circles
   //#define SF_ARC_FIX                // Enable only if using SkeinForge with "Arc Point" fillet procedure
+
+  /**
+   * Arc Fitting
+   *
+   * Replace runs of short G1 moves waiting in the command queue that follow a
+   * circular path with a single G2/G3 arc. Only moves in the XY plane with the
+   * same feedrate and extrusion ratio are fitted. Arcs can only be as long as
+   * the moves in the queue, so a larger BUFSIZE makes this more effective.
+   */
+  //#define ARC_FITTING
+  #if ENABLED(ARC_FITTING)
+    #define ARC_FIT_TOLERANCE     0.01 // (mm) Maximum distance of a fitted point or move from the arc
+    #define ARC_FIT_MAX          16    // Maximum number of G1 moves fitted into one arc (3-32)
+  #endif
 #endif
 
 // G5 Bézier Curve Support with XYZE destination and IJPQ offsets
@@ -2425,6 +2525,21 @@
   //#define CNC_WORKSPACE_PLANES      // Allow G2/G3/G5 to operate in XY, ZX, or YZ planes
 #endif
 
+/**
+ * G1 Segment Merging
+ *
+ * Merge runs of short, (nearly) collinear G1 moves waiting in the command queue
+ * into a single planner move. This helps to keep the planner buffer from filling
+ * up with tiny segments and reduces stuttering when printing over serial.
+ * Only moves with the same feedrate and extrusion ratio are merged.
+ */
+//#define SEGMENT_MERGING
+#if ENABLED(SEGMENT_MERGING)
+  #define SEGMENT_MERGE_TOLERANCE 0.01  // (mm) Maximum distance of a merged point from the resulting move
+  #define SEGMENT_MERGE_E_RATIO   1     // (%) Maximum difference in extrusion per mm between merged moves
+  #define SEGMENT_MERGE_MAX       8     // Maximum number of G1 moves merged into one (2-32)
+#endif
+
 /**
  * Direct Stepping
  *
@@ -2521,6 +2636,11 @@
 #define MAX_CMD_SIZE 96
 #define BUFSIZE 4
 
+// Pack queued commands end to end in a shared buffer of this many bytes instead
+// of using BUFSIZE buffers of MAX_CMD_SIZE. Most commands are much shorter than
+// MAX_CMD_SIZE, so BUFSIZE can be raised for the same RAM. (>= 2 * MAX_CMD_SIZE)
+//#define COMMAND_BUFFER_SIZE 512
+
 // Transmission to Host Buffer Size
 // To save 386 bytes of flash (and TX_BUFFER_SIZE+3 bytes of RAM) set to 0.
 // To buffer a simple "ok" you need 4 bytes.
@@ -3814,6 +3934,16 @@
 //#define MEATPACK_ON_SERIAL_PORT_1
 //#define MEATPACK_ON_SERIAL_PORT_2
 
+/**
+ * Binary G-code
+ * Accept commands pre-parsed by the host into compact binary packets, so the firmware
+ * doesn't scan text or convert numbers. Packets start with a byte that never starts a
+ * line of text, so text and binary commands can be mixed. Reported by M115 as a 'Cap'.
+ * Use buildroot/share/scripts/binary_gcode.py to encode G-code and compare sizes.
+ * Requires FASTER_GCODE_PARSER. Not compatible with EMERGENCY_PARSER.
+ */
+//#define BINARY_GCODE
+
 //#define GCODE_CASE_INSENSITIVE  // Accept G-code sent to the firmware in lowercase
 
 //#define REPETIER_GCODE_M360     // Add commands originally from Repetier FW
@@ -4370,6 +4500,18 @@
    * To help diagnose print quality issues stemming from empty command buffers.
    */
   //#define BUFFER_MONITORING
+
+  /**
+   * D580 - Step Trace
+   * Record the tick, axes, directions and planner block of the step pulses sent by the
+   * stepper ISR. Use buildroot/share/scripts/step_trace.py to get the velocity, acceleration
+   * and jerk of each axis from the trace, e.g., to check input shaping or multi-stepping.
+   * The Linux HAL benchmark can write the trace to a file with '--trace file.csv'.
+   */
+  //#define STEP_TRACE
+  #if ENABLED(STEP_TRACE)
+    #define STEP_TRACE_SIZE 1024  // Events held for sending (power of 2), 8 bytes each for up to 8 axes
+  #endif
 #endif
 
 /**
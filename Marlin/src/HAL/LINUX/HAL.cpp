@@ -23,6 +23,7 @@
 
 #include "../../inc/MarlinConfig.h"
 #include "../shared/Delay.h"
+#include "benchmark.h"
 
 // ------------------------
 // Serial ports
@@ -49,12 +50,48 @@ int freeMemory() { return 0; }
 
 uint8_t MarlinHAL::active_ch = 0;
 
-uint16_t MarlinHAL::adc_value() {
-  const pin_t pin = analogInputToDigitalPin(active_ch);
+static uint16_t adc_read(const uint8_t ch) {
+  const pin_t pin = analogInputToDigitalPin(ch);
   if (!VALID_PIN(pin)) return 0;
   return uint16_t((Gpio::get(pin) >> 2) & 0x3FF); // return 10bit value as Marlin expects
 }
 
+uint16_t MarlinHAL::adc_value() { return adc_read(active_ch); }
+
+#if ENABLED(ADC_DMA_RING)
+
+  /**
+   * Stand-in for an ADC scanning all inputs into a circular DMA buffer.
+   * Each timer interrupt stores one scan in the next row of the ring.
+   */
+  static uint16_t adc_ring[HAL_ADC_RING_DEPTH][NUM_ANALOG_INPUTS];
+  static uint8_t adc_ring_row = 0;
+
+  HAL_ADC_TIMER_ISR() {
+    for (uint8_t ch = 0; ch < NUM_ANALOG_INPUTS; ++ch) adc_ring[adc_ring_row][ch] = adc_read(ch);
+    if (++adc_ring_row >= HAL_ADC_RING_DEPTH) adc_ring_row = 0;
+  }
+
+  void MarlinHAL::adc_init() {
+    for (uint8_t i = 0; i < HAL_ADC_RING_DEPTH; ++i) TIMER2_IRQHandler(); // Fill the ring before the first reading
+    HAL_timer_start(MF_TIMER_ADC, ADC_TIMER_FREQUENCY);
+    HAL_timer_enable_interrupt(MF_TIMER_ADC);
+  }
+
+  uint16_t MarlinHAL::adc_ring_sum(const uint8_t ch) {
+    if (ch >= NUM_ANALOG_INPUTS) return 0;
+    uint16_t sum = 0;
+    for (uint8_t i = 0; i < HAL_ADC_RING_DEPTH; ++i) sum += adc_ring[i][ch];
+    return sum;
+  }
+
+#endif
+
+// In virtual time the simulation only advances when the firmware is idle
+void MarlinHAL::idletask() {
+  if (Clock::isVirtual()) MotionBenchmark::idle();
+}
+
 void MarlinHAL::reboot() { /* Reset the application state and GPIO */ }
 
 #endif // __PLAT_LINUX__
@@ -82,6 +82,7 @@ extern MSerialT usb_serial;
 // ADC
 #define HAL_ADC_VREF           5.0
 #define HAL_ADC_RESOLUTION    10
+#define HAL_ADC_RING_DEPTH    16  // Scans kept by the simulated DMA for ADC_DMA_RING
 
 // ------------------------
 // Class Utilities
@@ -122,7 +123,7 @@ public:
   static void delay_ms(const int ms) { _delay_ms(ms); }
 
   // Tasks, called from idle()
-  static void idletask() {}
+  static void idletask();
 
   // Reset
   static constexpr uint8_t reset_reason = RST_POWER_ON;
@@ -139,7 +140,11 @@ public:
   static uint8_t active_ch;
 
   // Called by Temperature::init once at startup
-  static void adc_init() {}
+  #if ENABLED(ADC_DMA_RING)
+    static void adc_init(); // Start the simulated DMA scan
+  #else
+    static void adc_init() {}
+  #endif
 
   // Called by Temperature::init for each sensor at startup
   static void adc_enable(const uint8_t) {}
@@ -153,6 +158,11 @@ public:
   // The current value of the ADC register
   static uint16_t adc_value();
 
+  #if ENABLED(ADC_DMA_RING)
+    // Sum of the last HAL_ADC_RING_DEPTH samples of the given channel
+    static uint16_t adc_ring_sum(const uint8_t ch);
+  #endif
+
   /**
    * Set the PWM duty cycle for the pin to the given value.
    * No option to change the resolution or invert the duty cycle.
@@ -0,0 +1,460 @@
+/**
+ * Marlin 3D Printer Firmware
+ *
+ * Copyright (c) 2023 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ * Copyright (c) 2016 Bob Cousins bobcousins42@googlemail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../inc/MarlinConfig.h"
+#include "../../gcode/queue.h"
+#include "../../module/planner.h"
+#include "../../module/temperature.h"
+#include "hardware/Heater.h"
+#include "hardware/LinearAxis.h"
+#include "hardware/Timer.h"
+#include "benchmark.h"
+#include "thermal_response.h"
+
+#if HAS_SEGMENT_MERGE
+  #include "../../feature/segment_merge.h"
+#endif
+#if HAS_BED_PROBE
+  #include "../../module/probe.h"
+#endif
+#if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+  #include "../../feature/bedlevel/bedlevel.h"
+#endif
+#if ENABLED(FT_MOTION)
+  #include "../../module/ft_motion.h"
+#endif
+#if ENABLED(STEP_TRACE)
+  #include "../../feature/step_trace.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <chrono>
+#include <fstream>
+#include <math.h>
+
+extern void setup();
+extern void loop();
+extern Timer timers[3];
+
+typedef struct {
+  uint64_t blocks,            // Blocks added to the planner buffer
+           underruns,         // Times the planner drained while input was still pending
+           steps,             // Step pulses seen by the simulated axes
+           isr_calls,         // Stepper ISR invocations
+           isr_host_ns,       // Host time spent inside the stepper ISR (informational)
+           temp_isr_calls,    // Temperature ISR invocations
+           temp_isr_host_ns,  // Host time spent inside the temperature ISR (informational)
+           ft_underruns,      // FT_MOTION stepper buffer underruns at the start of the file
+           start_ns,          // Virtual time at the start of the file
+           host_ns;           // Host time taken by the whole file (informational)
+} bench_stats_t;
+
+static bench_stats_t stats;
+static std::ifstream gcode_file;
+static uint8_t last_head;
+static bool planner_busy, verbose;
+static uint32_t stall_ms;
+static double peak_heater_watts;
+
+static Heater *hotend, *bed;
+static LinearAxis *axes[4];
+static ThermalResponse hotend_response("Hotend"), bed_response("Bed");
+#if HAS_MULTI_HOTEND
+  static Heater *hotend1;
+  static ThermalResponse hotend1_response("Hotend 1");
+#endif
+
+// A warped bed for the Z min endstop (probe) to find, in mm
+typedef struct {
+  double tilt_x, tilt_y,        // Slope across the bed center
+         bow,                   // Rise from the center to the middle of each edge
+         bump, bump_x, bump_y,  // A round bump (or dip) on the bed
+         bump_r;                // Radius of the bump (standard deviation)
+} bed_surface_t;
+
+static bool use_surface;
+static bed_surface_t surface = { 0, 0, 0, 0, X_CENTER, Y_CENTER, 20 };
+static uint64_t start_min_hits;
+
+#if ENABLED(STEP_TRACE)
+
+  static FILE *trace_file;
+
+  // Start the trace file with the header D580 sends
+  static void start_trace() {
+    fprintf(trace_file, "# step trace rate=%lu axes=", (unsigned long)(STEPPER_TIMER_RATE));
+    LOOP_L_N(a, LOGICAL_AXES) fprintf(trace_file, "%s%c", a ? "," : "", TERN_(HAS_EXTRUDERS, a == E_AXIS ? 'E' :) AXIS_CHAR(a));
+    fprintf(trace_file, " steps_per_mm=");
+    LOOP_L_N(a, LOGICAL_AXES) fprintf(trace_file, "%s%.4f", a ? "," : "", planner.settings.axis_steps_per_mm[a]);
+    fprintf(trace_file, "\n");
+    step_trace.start(false);
+  }
+
+  // Write the events recorded so far
+  static void write_trace() {
+    step_trace_event_t ev;
+    while (step_trace.pop(ev)) {
+      if (ev.steps)
+        fprintf(trace_file, "%lu,%u,%lu,%lu\n", (unsigned long)ev.tick, ev.block, (unsigned long)ev.steps, (unsigned long)ev.dirs);
+      else
+        fprintf(trace_file, "# dropped %lu\n", (unsigned long)ev.tick);
+    }
+  }
+
+#endif
+
+static double surface_z(const double x, const double y) {
+  const double cx = x - (X_CENTER), cy = y - (Y_CENTER),
+               bx = x - surface.bump_x, by = y - surface.bump_y;
+  return surface.tilt_x * cx + surface.tilt_y * cy
+       + surface.bow * (sq(cx / ((X_BED_SIZE) / 2.0)) + sq(cy / ((Y_BED_SIZE) / 2.0))) / 2
+       + surface.bump * exp(-(sq(bx) + sq(by)) / (2 * sq(surface.bump_r)));
+}
+
+// The bed height under the probe, in Z steps above the Z min endstop
+static int32_t surface_offset() {
+  xy_pos_t pos = {
+    (axes[X_AXIS]->position - axes[X_AXIS]->min_position) / planner.settings.axis_steps_per_mm[X_AXIS] + (X_MIN_POS),
+    (axes[Y_AXIS]->position - axes[Y_AXIS]->min_position) / planner.settings.axis_steps_per_mm[Y_AXIS] + (Y_MIN_POS)
+  };
+  TERN_(HAS_PROBE_XY_OFFSET, pos += probe.offset_xy);
+  return lround(surface_z(pos.x, pos.y) * planner.settings.axis_steps_per_mm[Z_AXIS]);
+}
+
+// Firmware output is not time-dependent, so drain it on a thread like main.cpp does
+static void drain_serial_thread() {
+  for (;;) {
+    for (std::size_t i = usb_serial.transmit_buffer.available(); i > 0; i--) {
+      const int c = usb_serial.transmit_buffer.read();
+      if (verbose) fputc(c, stderr);
+    }
+    std::this_thread::yield();
+  }
+}
+
+// Feed the G-code file into the serial receive buffer as fast as it will take it
+void MotionBenchmark::pump_serial() {
+  while (gcode_file.is_open() && usb_serial.receive_buffer.free()) {
+    const int c = gcode_file.get();
+    if (c == EOF) { gcode_file.close(); break; }
+    usb_serial.receive_buffer.write(uint8_t(c));
+  }
+}
+
+static bool input_pending() {
+  return gcode_file.is_open() || usb_serial.receive_buffer.available() || queue.has_commands_queued();
+}
+
+static uint64_t total_steps() {
+  uint64_t steps = 0;
+  for (LinearAxis *axis : axes) steps += axis->steps;
+  return steps;
+}
+
+/**
+ * Advance the simulation by one event. This is the only place where virtual
+ * time moves forward (apart from explicit delays) so the main loop and the
+ * interrupts interleave the same way on every run.
+ */
+void MotionBenchmark::idle() {
+  pump_serial();
+
+  Timer::dispatchNext();
+
+  hotend->update();
+  bed->update();
+  TERN_(HAS_MULTI_HOTEND, hotend1->update());
+
+  // Total power drawn by the heaters until the next event
+  double watts = hotend->model.heater_power * hotend->heater_duty + bed->model.heater_power * bed->heater_duty;
+  TERN_(HAS_MULTI_HOTEND, watts += hotend1->model.heater_power * hotend1->heater_duty);
+  NOLESS(peak_heater_watts, watts);
+
+  // Measure the modeled sensor, not the firmware's reading of it, so ADC steps don't count as error
+  TERN_(HAS_HOTEND, hotend_response.update(thermalManager.degTargetHotend(0), hotend->sensor_temp, Clock::nanos()));
+  TERN_(HAS_MULTI_HOTEND, hotend1_response.update(thermalManager.degTargetHotend(1), hotend1->sensor_temp, Clock::nanos()));
+  TERN_(HAS_HEATED_BED, bed_response.update(thermalManager.degTargetBed(), bed->sensor_temp, Clock::nanos()));
+
+  // Count the blocks added since the last call. Fewer than BLOCK_BUFFER_SIZE
+  // blocks can be added between calls since a full buffer waits in idle().
+  const uint8_t head = planner.block_buffer_head;
+  stats.blocks += BLOCK_MOD(head - last_head);
+  last_head = head;
+
+  const bool busy = planner.has_blocks_queued();
+  if (planner_busy && !busy && input_pending()) stats.underruns++;
+  planner_busy = busy;
+
+  TERN_(STEP_TRACE, if (trace_file) write_trace());
+}
+
+void MotionBenchmark::report(const char * const filename) {
+  const double secs = (Clock::nanos() - stats.start_ns) / 1000000000.0;
+  const uint64_t steps = total_steps() - stats.steps,
+                 isr_calls = timers[MF_TIMER_STEP].getEvents() - stats.isr_calls,
+                 isr_host_ns = timers[MF_TIMER_STEP].getBusyNanos() - stats.isr_host_ns,
+                 temp_isr_calls = timers[MF_TIMER_TEMP].getEvents() - stats.temp_isr_calls,
+                 temp_isr_host_ns = timers[MF_TIMER_TEMP].getBusyNanos() - stats.temp_isr_host_ns;
+
+  printf("Benchmark: %s\n", filename);
+  printf("  Blocks planned          : %llu\n", (unsigned long long)stats.blocks);
+  printf("  Virtual time (s)        : %.6f\n", secs);
+  printf("  Blocks/s (virtual)      : %.2f\n", secs > 0 ? stats.blocks / secs : 0.0);
+  printf("  Blocks/s (host)         : %.0f\n", stats.host_ns ? stats.blocks * 1e9 / stats.host_ns : 0.0);
+  printf("  Steps                   : %llu\n", (unsigned long long)steps);
+  printf("  Stepper ISR calls       : %llu\n", (unsigned long long)isr_calls);
+  if (steps) {
+    printf("  ISR calls per step      : %.4f\n", double(isr_calls) / steps);
+    printf("  Timer ticks per step    : %.2f\n", secs * (STEPPER_TIMER_RATE) / steps);
+    printf("  ISR host ticks per step : %.2f\n", isr_host_ns * ((STEPPER_TIMER_RATE) / 1e9) / steps);
+  }
+  printf("  Planner underruns       : %llu\n", (unsigned long long)stats.underruns);
+  #if ENABLED(FT_MOTION)
+    printf("  FT_MOTION underruns     : %llu\n", (unsigned long long)(fxdTiCtrl.underruns - stats.ft_underruns));
+  #endif
+  #if ENABLED(STEP_TRACE)
+    if (trace_file)
+      printf("  Step trace events       : %lu (%lu dropped)\n", (unsigned long)step_trace.recorded, (unsigned long)step_trace.dropped);
+  #endif
+  printf("  Temp update period (ms) : %.1f\n", (TEMP_UPDATE_LOOPS) * float(ACTUAL_ADC_SAMPLES) * 1000 / (TEMP_TIMER_FREQUENCY));
+  if (temp_isr_calls)
+    printf("  Temp ISR host ns / call : %.0f\n", double(temp_isr_host_ns) / temp_isr_calls);
+  printf("  Peak heater power (W)   : %.0f\n", peak_heater_watts);
+  #if HAS_SEGMENT_MERGE
+    printf("  G1 segments merged      : %lu -> %lu\n", (unsigned long)segment_merge.segments_in, (unsigned long)segment_merge.moves_out);
+  #endif
+  #if ENABLED(ARC_FITTING)
+    printf("  Arcs fitted             : %lu\n", (unsigned long)segment_merge.arcs_out);
+  #endif
+  #if ENABLED(BUFFER_MONITORING)
+    printf("  Planner kernel calls    : %lu\n", (unsigned long)planner.kernel_calls);
+    printf("  Planner kernels skipped : %lu\n", (unsigned long)planner.kernel_calls_skipped);
+  #endif
+  if (use_surface) {
+    printf("  Z min triggers          : %llu\n", (unsigned long long)(axes[Z_AXIS]->min_hits - start_min_hits));
+    #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+      // Compare the leveling correction with the bed over the mesh area. Homing sets
+      // the Z origin, so leave out the mean difference.
+      if (leveling_is_valid()) {
+        constexpr int n = 41;
+        double diff[n][n], mean = 0, max_error = 0, rms = 0;
+        for (int i = 0; i < n; i++) for (int j = 0; j < n; j++) {
+          const xy_pos_t pos = {
+            bedlevel.grid_start.x + bedlevel.grid_spacing.x * i * (GRID_MAX_CELLS_X) / (n - 1),
+            bedlevel.grid_start.y + bedlevel.grid_spacing.y * j * (GRID_MAX_CELLS_Y) / (n - 1)
+          };
+          diff[i][j] = bedlevel.get_z_correction(pos) - surface_z(pos.x, pos.y);
+          mean += diff[i][j] / sq(n);
+        }
+        for (int i = 0; i < n; i++) for (int j = 0; j < n; j++) {
+          const double e = diff[i][j] - mean;
+          max_error = _MAX(max_error, ABS(e));
+          rms += sq(e) / sq(n);
+        }
+        printf("  Mesh error max/rms (mm) : %.4f / %.4f\n", max_error, sqrt(rms));
+      }
+    #endif
+  }
+  hotend_response.finish(Clock::nanos());
+  TERN_(HAS_MULTI_HOTEND, hotend1_response.finish(Clock::nanos()));
+  bed_response.finish(Clock::nanos());
+  fflush(stdout);
+}
+
+// A key of a "key=value,..." list, and the field it sets
+template<typename T> struct list_key_t { const char *key; double T::*field; };
+
+/**
+ * Set the fields of 'out' from a list like "key=value,key=value".
+ * Return false if a key is unknown or a value is missing.
+ */
+template<typename T, size_t N>
+static bool parse_list(const char * const arg, const list_key_t<T> (&keys)[N], T &out) {
+  char list[256];
+  strncpy(list, arg, sizeof(list) - 1);
+  list[sizeof(list) - 1] = '\0';
+  for (char *item = strtok(list, ","); item; item = strtok(nullptr, ",")) {
+    char * const value = strchr(item, '=');
+    if (!value) return false;
+    *value = '\0';
+    bool found = false;
+    for (const auto &k : keys)
+      if (!strcmp(item, k.key)) { out.*k.field = atof(value + 1); found = true; }
+    if (!found) return false;
+  }
+  return true;
+}
+
+/**
+ * Set heater model parameters from a list like "power=40,capacity=16.7".
+ * The block must lose heat to ambient air, or it has no steady temperature to settle to.
+ */
+static bool parse_model(const char * const arg, HeaterModel &model) {
+  static const list_key_t<HeaterModel> keys[] = {
+    { "power", &HeaterModel::heater_power },
+    { "capacity", &HeaterModel::heat_capacity },
+    { "sensor", &HeaterModel::sensor_responsiveness },
+    { "ambient", &HeaterModel::ambient_xfer },
+    { "fan", &HeaterModel::ambient_xfer_fan255 },
+    { "filament", &HeaterModel::filament_heat },
+    { "room", &HeaterModel::ambient_temp }
+  };
+  return parse_list(arg, keys, model)
+      && model.heater_power >= 0 && model.heat_capacity > 0 && model.sensor_responsiveness > 0
+      && model.ambient_xfer > 0 && model.ambient_xfer_fan255 > 0 && model.filament_heat >= 0;
+}
+
+// Set bed surface parameters from a list like "bow=0.2,bump=0.1"
+static bool parse_surface(const char * const arg) {
+  static const list_key_t<bed_surface_t> keys[] = {
+    { "tilt_x", &bed_surface_t::tilt_x },
+    { "tilt_y", &bed_surface_t::tilt_y },
+    { "bow", &bed_surface_t::bow },
+    { "bump", &bed_surface_t::bump },
+    { "bump_x", &bed_surface_t::bump_x },
+    { "bump_y", &bed_surface_t::bump_y },
+    { "bump_r", &bed_surface_t::bump_r }
+  };
+  return parse_list(arg, keys, surface);
+}
+
+int MotionBenchmark::run(int argc, char *argv[]) {
+  Clock::useVirtualTime(Timer::waitUntil);
+  Clock::setFrequency(F_CPU);
+
+  // Options come before the files
+  HeaterModel hotend_model = hotend_model_default, bed_model = bed_model_default;
+  int first_file = 1;
+  for (; first_file < argc; first_file++) {
+    const char * const arg = argv[first_file], * const value = first_file + 1 < argc ? argv[first_file + 1] : "";
+    if (!strcmp(arg, "--benchmark")) continue;
+    if (!strcmp(arg, "--verbose")) { verbose = true; continue; }
+    if (!strcmp(arg, "--band")) { ThermalResponse::band = atof(value); first_file++; continue; }
+    if (!strcmp(arg, "--stall")) { stall_ms = atoi(value); first_file++; continue; }
+    if (!strcmp(arg, "--trace")) {
+      #if ENABLED(STEP_TRACE)
+        trace_file = fopen(value, "w");
+        if (!trace_file) {
+          fprintf(stderr, "Benchmark: can't write %s\n", value);
+          return 1;
+        }
+      #else
+        fprintf(stderr, "Benchmark: --trace requires STEP_TRACE\n");
+        return 1;
+      #endif
+      first_file++;
+      continue;
+    }
+    if (!strcmp(arg, "--surface")) {
+      if (!parse_surface(value)) {
+        fprintf(stderr, "Benchmark: bad bed surface '%s'\n", value);
+        return 1;
+      }
+      use_surface = true;
+      first_file++;
+      continue;
+    }
+    if (!strcmp(arg, "--hotend") || !strcmp(arg, "--bed")) {
+      if (!parse_model(value, arg[2] == 'h' ? hotend_model : bed_model)) {
+        fprintf(stderr, "Benchmark: bad heater model '%s'\n", value);
+        return 1;
+      }
+      first_file++;
+      continue;
+    }
+    break;
+  }
+
+  std::thread drain_serial(drain_serial_thread);
+  drain_serial.detach();
+
+  LinearAxis x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN),
+             y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN),
+             z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN),
+             extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
+  Heater sim_hotend(HEATER_0_PIN, TEMP_0_PIN, hotend_model, Heater::hotend_celsius, FAN0_PIN, &extruder0),
+         sim_bed(HEATER_BED_PIN, TEMP_BED_PIN, bed_model, Heater::bed_celsius);
+  hotend = &sim_hotend; bed = &sim_bed;
+  #if HAS_MULTI_HOTEND
+    Heater sim_hotend1(HEATER_1_PIN, TEMP_1_PIN, hotend_model, Heater::hotend1_celsius);
+    hotend1 = &sim_hotend1;
+  #endif
+  axes[0] = &x_axis; axes[1] = &y_axis; axes[2] = &z_axis; axes[3] = &extruder0;
+  if (use_surface) z_axis.min_offset = surface_offset;
+
+  HAL_timer_init();
+
+  MYSERIAL1.begin(BAUDRATE);
+  setup();
+  TERN_(STEP_TRACE, if (trace_file) start_trace());
+
+  int result = 0;
+  for (int i = first_file; i < argc; i++) {
+    gcode_file.open(argv[i], std::ios::binary);
+    if (!gcode_file.is_open()) {
+      fprintf(stderr, "Benchmark: can't open %s\n", argv[i]);
+      result = 1;
+      continue;
+    }
+
+    stats = bench_stats_t({ 0, 0, total_steps(), timers[MF_TIMER_STEP].getEvents(), timers[MF_TIMER_STEP].getBusyNanos(),
+                            timers[MF_TIMER_TEMP].getEvents(), timers[MF_TIMER_TEMP].getBusyNanos(),
+                            TERN0(FT_MOTION, fxdTiCtrl.underruns), Clock::nanos(), 0 });
+    last_head = planner.block_buffer_head;
+    TERN_(BUFFER_MONITORING, planner.kernel_calls = planner.kernel_calls_skipped = 0);
+    TERN_(HAS_SEGMENT_MERGE, segment_merge.reset_stats());
+    planner_busy = planner.has_blocks_queued();
+    peak_heater_watts = 0;
+    start_min_hits = z_axis.min_hits;
+    hotend_response.restart();
+    TERN_(HAS_MULTI_HOTEND, hotend1_response.restart());
+    bed_response.restart();
+
+    // Run until every command is processed and every block has been stepped out.
+    // A stall blocks the main loop after each pass while the interrupts carry on.
+    const auto host_start = std::chrono::steady_clock::now();
+    do {
+      loop();
+      if (stall_ms) delay(stall_ms);
+    } while (input_pending() || planner.has_blocks_queued());
+    stats.host_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - host_start).count();
+
+    report(argv[i]);
+  }
+
+  #if ENABLED(STEP_TRACE)
+    if (trace_file) {
+      step_trace.stop();
+      write_trace();
+      const uint32_t end_drops = step_trace.take_end_drops();
+      if (end_drops) fprintf(trace_file, "# dropped %lu\n", (unsigned long)end_drops);
+      fclose(trace_file);
+    }
+  #endif
+
+  return result;
+}
+
+#endif // __PLAT_LINUX__
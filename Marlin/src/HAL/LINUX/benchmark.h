@@ -0,0 +1,67 @@
+/**
+ * Marlin 3D Printer Firmware
+ *
+ * Copyright (c) 2023 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ * Copyright (c) 2016 Bob Cousins bobcousins42@googlemail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Deterministic motion-pipeline benchmark for the Linux HAL
+ *
+ * Runs the firmware in virtual time: the clock only advances when a simulated
+ * timer fires or a delay is requested, so every run of the same G-code file
+ * produces the same plan, the same step timing and the same statistics.
+ *
+ * The heaters follow the thermal model in hardware/Heater.cpp, so heating, PID and
+ * MPC autotuning (M303, M306 T) also run here in accelerated time. The step response
+ * of each heater is reported with the motion statistics for each file.
+ *
+ * Usage: marlin --benchmark [--verbose] [--band C] [--hotend key=value,...] [--bed key=value,...]
+ *                           [--surface key=value,...] [--stall ms] [--trace file.csv]
+ *                           file.gcode [file2.gcode ...]
+ *
+ *   --band    Settling band for the step response, in °C. Default 1.
+ *   --hotend  Hotend model parameters:
+ *   --bed     Bed model parameters:
+ *               power=W capacity=J/K sensor=K/s/K ambient=W/K fan=W/K filament=J/K/mm room=°C
+ *             capacity, sensor, ambient and fan must be above 0.
+ *   --surface A warped bed for the Z min endstop (probe) to find, in mm:
+ *               tilt_x=mm/mm tilt_y=mm/mm bow=mm bump=mm bump_x=mm bump_y=mm bump_r=mm
+ *             The Z min triggers and the leveling mesh error are then reported.
+ *   --stall   Block the main loop for this many ms after each pass, as a slow SD read or
+ *             display update would. Only the interrupts run meanwhile, so motion planned
+ *             in idle() (such as FT_MOTION without FTM_TIMER_TASK) runs dry.
+ *   --trace   Write the step pulses of all the files to a file, as D580 sends them.
+ *             (Requires STEP_TRACE) Read it with buildroot/share/scripts/step_trace.py.
+ *
+ * Example: marlin --benchmark --hotend power=50,capacity=20 buildroot/test-gcode/thermal-step.gcode
+ */
+
+#include <stdint.h>
+
+class MotionBenchmark {
+public:
+  static int run(int argc, char *argv[]);
+
+  // Called from idle() while virtual time is in use
+  static void idle();
+
+private:
+  static void pump_serial();
+  static void report(const char * const filename);
+};
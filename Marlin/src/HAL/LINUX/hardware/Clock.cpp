@@ -27,5 +27,7 @@
 std::chrono::nanoseconds Clock::startup = std::chrono::high_resolution_clock::now().time_since_epoch();
 uint32_t Clock::frequency = F_CPU;
 double Clock::time_multiplier = 1.0;
+Clock::virtual_wait_fn *Clock::virtual_wait = nullptr;
+uint64_t Clock::virtual_nanos = 0;
 
 #endif // __PLAT_LINUX__
@@ -26,6 +26,7 @@
 
 class Clock {
 public:
+  typedef void (virtual_wait_fn)(uint64_t until_ns);
   static uint64_t ticks(uint32_t frequency = Clock::frequency) {
     return (Clock::nanos() - Clock::startup.count()) / (1000000000ULL / frequency);
   }
@@ -45,6 +46,7 @@ public:
 
   // Time Acceleration compensated
   static uint64_t nanos() {
+    if (Clock::virtual_wait) return Clock::virtual_nanos;
     auto now = std::chrono::high_resolution_clock::now().time_since_epoch();
     return (now.count() - Clock::startup.count()) * Clock::time_multiplier;
   }
@@ -62,18 +64,22 @@ public:
   }
 
   static void delayCycles(uint64_t cycles) {
+    if (Clock::virtual_wait) return Clock::delayVirtual(((1000000000ULL / frequency) * cycles));
     std::this_thread::sleep_for(std::chrono::nanoseconds( (1000000000L / frequency) * cycles) / Clock::time_multiplier );
   }
 
   static void delayMicros(uint64_t micros) {
+    if (Clock::virtual_wait) return Clock::delayVirtual(micros * 1000ULL);
     std::this_thread::sleep_for(std::chrono::microseconds( micros ) / Clock::time_multiplier);
   }
 
   static void delayMillis(uint64_t millis) {
+    if (Clock::virtual_wait) return Clock::delayVirtual(millis * 1000000ULL);
     std::this_thread::sleep_for(std::chrono::milliseconds( millis ) / Clock::time_multiplier);
   }
 
   static void delaySeconds(double secs) {
+    if (Clock::virtual_wait) return Clock::delayVirtual(uint64_t(secs * 1000000000.0));
     std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(secs * 1000) / Clock::time_multiplier);
   }
 
@@ -82,8 +88,34 @@ public:
     Clock::time_multiplier = tm;
   }
 
+  /**
+   * Virtual time: the clock stands still until simulated events move it forward.
+   * Delays hand control to 'fn', which must dispatch any due events and then
+   * call advanceTo() with the requested end time. Used for deterministic runs.
+   */
+  static void useVirtualTime(virtual_wait_fn *fn) {
+    Clock::virtual_wait = fn;
+    Clock::virtual_nanos = 0;
+    Clock::time_multiplier = 1.0;
+  }
+
+  static bool isVirtual() {
+    return Clock::virtual_wait != nullptr;
+  }
+
+  // Move virtual time forward, never backward
+  static void advanceTo(uint64_t ns) {
+    if (ns > Clock::virtual_nanos) Clock::virtual_nanos = ns;
+  }
+
 private:
+  static void delayVirtual(uint64_t ns) {
+    Clock::virtual_wait(Clock::virtual_nanos + ns);
+  }
+
   static std::chrono::nanoseconds startup;
   static uint32_t frequency;
   static double time_multiplier;
+  static virtual_wait_fn *virtual_wait;
+  static uint64_t virtual_nanos;
 };
@@ -23,34 +23,91 @@
 
 #include "Clock.h"
 #include <stdio.h>
+#include <math.h>
 #include "../../../inc/MarlinConfig.h"
+#include "../../../module/planner.h"
+#include "../../../module/temperature.h"
 
 #include "Heater.h"
 
-Heater::Heater(pin_t heater, pin_t adc) {
-  heater_state = 0;
-  room_temp_raw = 150;
-  last = Clock::micros();
-  heater_pin = heater;
-  adc_pin = adc;
-  heat = 0.0;
+Heater::Heater(pin_t heater, pin_t adc, const HeaterModel &model, sensor_fn to_celsius, pin_t fan/*=P_NC*/, const LinearAxis *filament/*=nullptr*/)
+  : heater_pin(heater), adc_pin(adc), fan_pin(fan), model(model), to_celsius(to_celsius), filament(filament) {
+  block_temp = sensor_temp = model.ambient_temp;
+  heater_duty = fan_duty = adc_error = 0;
+  last_filament_position = filament ? filament->position : 0;
+  last = Clock::nanos();
 }
 
 Heater::~Heater() {
 }
 
+// Pins are set with digitalWrite (0, 1) for software PWM or analogWrite (0-255)
+double Heater::duty(const pin_t pin) {
+  if (!Gpio::valid_pin(pin)) return 0;
+  const uint16_t value = Gpio::pin_map[pin].value;
+  return value <= 1 ? value : _MIN(value, 255) / 255.0;
+}
+
+/**
+ * The ADC reading for the sensor temperature, found by bisecting the firmware's own conversion
+ * over oversampled values. Each read returns one of the two nearest 10-bit values, chosen by a
+ * sigma-delta so the sum of OVERSAMPLENR reads resolves the fraction, as noise does on real hardware.
+ */
+uint16_t Heater::sensor_adc() {
+  constexpr int32_t raw_max = MAX_RAW_THERMISTOR_VALUE;
+  const bool rising = to_celsius(raw_max) > to_celsius(0);
+  int32_t lo = 0, hi = raw_max;
+  while (hi - lo > 1) {
+    const int32_t mid = (lo + hi) / 2;
+    if ((to_celsius(mid) < sensor_temp) == rising) lo = mid; else hi = mid;
+  }
+  const double adc = double(lo) / (OVERSAMPLENR) + adc_error;
+  const uint16_t out = _MIN(uint16_t(adc + 0.5), uint16_t(HAL_ADC_RANGE - 1));
+  adc_error = adc - out;
+  return out;
+}
+
 void Heater::update() {
-  // crude pwm read and cruder heat simulation
-  auto now = Clock::micros();
-  double delta = (now - last);
-  if (delta > 1000 ) {
-    heater_state = pwmcap.update(0xFFFF * Gpio::pin_map[heater_pin].value);
-    last = now;
-    heat += (heater_state - heat) * (delta / 1000000000.0);
-
-    NOLESS(heat, room_temp_raw);
-    Gpio::pin_map[analogInputToDigitalPin(adc_pin)].value = 0xFFFF - (uint16_t)heat;
+  const uint64_t now = Clock::nanos();
+  if (now <= last) return;
+  const double dt = (now - last) / 1000000000.0;
+  last = now;
+
+  // Filament fed since the last update
+  double feed_rate = 0;
+  if (filament) {
+    const int32_t moved = filament->position - last_filament_position;
+    last_filament_position = filament->position;
+    if (moved > 0) feed_rate = moved / planner.settings.axis_steps_per_mm[E_AXIS_N(0)] / dt;
   }
+
+  // The inputs were constant over the interval, so step the block by the exact solution
+  const double loss = model.ambient_xfer + (model.ambient_xfer_fan255 - model.ambient_xfer) * fan_duty
+                    + model.filament_heat * feed_rate,
+               steady = model.ambient_temp + model.heater_power * heater_duty / loss,
+               prev_block = block_temp;
+  block_temp = steady + (block_temp - steady) * exp(-loss * dt / model.heat_capacity);
+
+  // The sensor follows the block, using its average temperature over the interval
+  const double block_avg = 0.5 * (prev_block + block_temp);
+  sensor_temp = block_avg + (sensor_temp - block_avg) * exp(-model.sensor_responsiveness * dt);
+
+  heater_duty = duty(heater_pin);
+  fan_duty = duty(fan_pin);
+
+  Gpio::pin_map[analogInputToDigitalPin(adc_pin)].value = sensor_adc() << 2;
+}
+
+float Heater::hotend_celsius(const uint16_t raw) {
+  return TERN(HAS_HOTEND, thermalManager.analog_to_celsius_hotend(raw, 0), 0);
+}
+
+float Heater::hotend1_celsius(const uint16_t raw) {
+  return TERN(HAS_MULTI_HOTEND, thermalManager.analog_to_celsius_hotend(raw, 1), 0);
+}
+
+float Heater::bed_celsius(const uint16_t raw) {
+  return TERN(HAS_HEATED_BED, thermalManager.analog_to_celsius_bed(raw), 0);
 }
 
 void Heater::interrupt(GpioEvent ev) {
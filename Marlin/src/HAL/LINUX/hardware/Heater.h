@@ -22,26 +22,57 @@
 #pragma once
 
 #include "Gpio.h"
+#include "LinearAxis.h"
 
-struct LowpassFilter {
-  uint64_t data_delay = 0;
-  uint16_t update(uint16_t value) {
-    data_delay += value - (data_delay >> 6);
-    return uint16_t(data_delay >> 6);
-  }
+/**
+ * Lumped thermal model of a heater block. The block gains heater power and loses heat
+ * to ambient air (more with the part cooling fan on) and to the filament passing through it.
+ * The sensor follows the block temperature with a first order lag. The parameters have
+ * the same meaning as the MPC settings, so MPC autotune should recover them.
+ */
+struct HeaterModel {
+  double heater_power,          // (W) Heater power at full duty
+         heat_capacity,         // (J/K) Heat capacity of the block
+         sensor_responsiveness, // (K/s per K) Rate the sensor follows the block
+         ambient_xfer,          // (W/K) Heat transfer to ambient with the fan off
+         ambient_xfer_fan255,   // (W/K) Heat transfer to ambient with the fan at full speed
+         filament_heat,         // (J/K/mm) Heat capacity of each mm of filament
+         ambient_temp;          // (°C) Ambient temperature
 };
 
+// Default models: an E3D V6 style hotend and a 220mm aluminium bed
+constexpr HeaterModel hotend_model_default = { 40.0, 16.7, 0.22, 0.068, 0.097, 0.0056, 25.0 },
+                      bed_model_default    = { 250.0, 350.0, 0.1, 1.8, 1.9, 0.0, 25.0 };
+
+// The firmware's conversion from an oversampled ADC value to °C
+typedef float (*sensor_fn)(const uint16_t raw);
+
 class Heater: public Peripheral {
 public:
-  Heater(pin_t heater, pin_t adc);
+  Heater(pin_t heater, pin_t adc, const HeaterModel &model, sensor_fn to_celsius, pin_t fan=P_NC, const LinearAxis *filament=nullptr);
   virtual ~Heater();
   void interrupt(GpioEvent ev);
   void update();
 
-  pin_t heater_pin, adc_pin;
-  uint16_t room_temp_raw;
-  uint16_t heater_state;
-  LowpassFilter pwmcap;
-  double heat;
+  // Sensor conversions for the simulated heaters
+  static float hotend_celsius(const uint16_t raw);
+  static float hotend1_celsius(const uint16_t raw);
+  static float bed_celsius(const uint16_t raw);
+
+  pin_t heater_pin, adc_pin, fan_pin;
+  HeaterModel model;
+  sensor_fn to_celsius;
+  const LinearAxis *filament;
+
+  double block_temp,    // (°C) Block temperature
+         sensor_temp,   // (°C) Temperature at the sensor
+         heater_duty,   // Heater and fan duty, held since the last update
+         fan_duty,
+         adc_error;     // Sigma-delta residue, to give oversampling sub-LSB resolution
+  int32_t last_filament_position;
   uint64_t last;
+
+private:
+  static double duty(const pin_t pin);
+  uint16_t sensor_adc();
 };
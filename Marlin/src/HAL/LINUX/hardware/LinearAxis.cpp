@@ -37,6 +37,9 @@ LinearAxis::LinearAxis(pin_type enable, pin_type dir, pin_type step, pin_type en
   max_position = (200*80) + min_position;
   position = rand() % ((max_position - 40) - min_position) + (min_position + 20);
   last_update = Clock::nanos();
+  steps = 0;
+  min_hits = 0;
+  min_offset = nullptr;
 
   Gpio::attachPeripheral(step_pin, this);
 
@@ -54,8 +57,11 @@ void LinearAxis::interrupt(GpioEvent ev) {
   if (ev.pin_id == step_pin && !Gpio::pin_map[enable_pin].value) {
     if (ev.event == GpioEvent::RISE) {
       last_update = ev.timestamp;
+      steps++;
       position += -1 + 2 * Gpio::pin_map[dir_pin].value;
-      Gpio::pin_map[min_pin].value = (position < min_position);
+      const bool hit = position < min_position + (min_offset ? min_offset() : 0);
+      if (hit && !Gpio::pin_map[min_pin].value) min_hits++;
+      Gpio::pin_map[min_pin].value = hit;
       //Gpio::pin_map[max_pin].value = (position > max_position);
       //if (position < min_position) printf("axis(%d) endstop : pos: %d, mm: %f, min: %d\n", step_pin, position, position / 80.0, Gpio::pin_map[min_pin].value);
     }
@@ -41,5 +41,10 @@ public:
   int32_t min_position;
   int32_t max_position;
   uint64_t last_update;
+  uint64_t steps;
+  uint64_t min_hits;            // Times the min endstop was triggered
+
+  // Optional shift of the min endstop in steps, such as the bed height under a probe
+  int32_t (*min_offset)();
 
 };
@@ -23,6 +23,11 @@
 
 #include "Timer.h"
 #include <stdio.h>
+#include <algorithm>
+
+Timer* Timer::virtual_timers[4];
+uint8_t Timer::virtual_count = 0;
+bool Timer::in_isr = false;
 
 Timer::Timer() {
   active = false;
@@ -34,10 +39,13 @@ Timer::Timer() {
   period = 0;
   start_time = 0;
   avg_error = 0;
+  deadline = UINT64_MAX;
+  events = 0;
+  busy_nanos = 0;
 }
 
 Timer::~Timer() {
-  timer_delete(timerid);
+  if (!Clock::isVirtual()) timer_delete(timerid);
 }
 
 void Timer::init(uint32_t sig_id, uint32_t sim_freq, callback_fn* fn) {
@@ -47,6 +55,11 @@ void Timer::init(uint32_t sig_id, uint32_t sim_freq, callback_fn* fn) {
   frequency = sim_freq;
   cbfn = fn;
 
+  if (Clock::isVirtual()) {
+    if (virtual_count < sizeof(virtual_timers) / sizeof(virtual_timers[0])) virtual_timers[virtual_count++] = this;
+    return;
+  }
+
   sa.sa_flags = SA_SIGINFO;
   sa.sa_sigaction = Timer::handler;
   sigemptyset(&sa.sa_mask);
@@ -73,6 +86,7 @@ void Timer::start(uint32_t frequency) {
 }
 
 void Timer::enable() {
+  if (Clock::isVirtual()) { active = true; return; }
   if (sigprocmask(SIG_UNBLOCK, &mask, nullptr) == -1) {
     return; // todo: handle error
   }
@@ -81,6 +95,7 @@ void Timer::enable() {
 }
 
 void Timer::disable() {
+  if (Clock::isVirtual()) { active = false; return; }
   if (sigprocmask(SIG_SETMASK, &mask, nullptr) == -1) {
     return; // todo: handle error
   }
@@ -88,6 +103,15 @@ void Timer::disable() {
 }
 
 void Timer::setCompare(uint32_t compare) {
+  if (Clock::isVirtual()) {
+    // The counter restarts from zero, as it does for the POSIX timer below
+    this->compare = compare;
+    this->period = std::max(Clock::ticksToNanos(compare, frequency), Clock::ticksToNanos(1, frequency));
+    this->start_time = Clock::nanos();
+    this->deadline = this->start_time + this->period;
+    return;
+  }
+
   uint32_t nsec_offset = 0;
   if (active) {
     nsec_offset = Clock::nanos() - this->start_time; // calculate how long the timer would have been running for
@@ -111,7 +135,44 @@ void Timer::setCompare(uint32_t compare) {
 }
 
 uint32_t Timer::getCount() {
+  // Reading the counter costs one tick, so busy-waits on it always make progress
+  if (Clock::isVirtual()) Clock::advanceTo(Clock::nanos() + Clock::ticksToNanos(1, frequency));
   return Clock::nanosToTicks(Clock::nanos() - this->start_time, frequency);
 }
 
+// Run the callback of a virtual timer that has reached its deadline
+void Timer::fire() {
+  Clock::advanceTo(deadline);
+  start_time = deadline;
+  deadline += period; // Periodic unless the callback sets a new compare value
+  events++;
+  in_isr = true;
+  const auto host_start = std::chrono::steady_clock::now();
+  cbfn();
+  busy_nanos += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - host_start).count();
+  in_isr = false;
+}
+
+/**
+ * Fire the enabled virtual timer with the earliest deadline, if it is not
+ * later than 'limit_ns'. Return false if there was nothing to dispatch.
+ */
+bool Timer::dispatchNext(uint64_t limit_ns) {
+  if (in_isr) return false; // No nested interrupts
+  Timer *next = nullptr;
+  for (uint8_t i = 0; i < virtual_count; i++) {
+    Timer * const t = virtual_timers[i];
+    if (t->active && t->cbfn && (!next || t->deadline < next->deadline)) next = t;
+  }
+  if (!next || next->deadline > limit_ns) return false;
+  next->fire();
+  return true;
+}
+
+// Virtual delay: let all events up to 'until_ns' happen, then jump to it
+void Timer::waitUntil(uint64_t until_ns) {
+  while (dispatchNext(until_ns)) { /* nada */ }
+  Clock::advanceTo(until_ns);
+}
+
 #endif // __PLAT_LINUX__
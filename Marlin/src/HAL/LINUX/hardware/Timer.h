@@ -48,6 +48,14 @@ public:
   uint32_t getOverruns() {return overruns;}
   uint32_t getAvgError() {return avg_error;}
 
+  uint64_t getEvents() {return events;}
+  uint64_t getBusyNanos() {return busy_nanos;}
+
+  // Virtual time: timers fire only when dispatched from the main thread
+  static bool dispatchNext(uint64_t limit_ns=UINT64_MAX);
+  static void waitUntil(uint64_t until_ns);
+  static bool inISR() {return in_isr;}
+
   intptr_t getID() {
     return (*(intptr_t*)timerid);
   }
@@ -73,4 +81,13 @@ private:
   uint64_t period;
   uint64_t avg_error;
   uint64_t start_time;
+  uint64_t deadline;
+  uint64_t events;
+  uint64_t busy_nanos;
+
+  void fire();
+
+  static Timer* virtual_timers[4];
+  static uint8_t virtual_count;
+  static bool in_isr;
 };
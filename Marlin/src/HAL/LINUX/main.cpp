@@ -29,9 +29,11 @@
 #include "hardware/IOLoggerCSV.h"
 #include "hardware/Heater.h"
 #include "hardware/LinearAxis.h"
+#include "benchmark.h"
 
 #include <stdio.h>
 #include <stdarg.h>
+#include <unistd.h>
 #include <thread>
 #include <iostream>
 #include <fstream>
@@ -50,23 +52,24 @@ void write_serial_thread() {
 }
 
 void read_serial_thread() {
-  char buffer[255] = {};
+  uint8_t buffer[254];
   for (;;) {
-    std::size_t len = _MIN(usb_serial.receive_buffer.free(), 254U);
-    if (fgets(buffer, len, stdin))
-      for (std::size_t i = 0; i < strlen(buffer); i++)
-        usb_serial.receive_buffer.write(buffer[i]);
+    // Read raw bytes so binary data (e.g., BINARY_GCODE packets) passes through intact
+    const std::size_t len = _MIN(usb_serial.receive_buffer.free(), sizeof(buffer));
+    const ssize_t count = len ? read(STDIN_FILENO, buffer, len) : 0;
+    for (ssize_t i = 0; i < count; i++)
+      usb_serial.receive_buffer.write(buffer[i]);
     std::this_thread::yield();
   }
 }
 
 void simulation_loop() {
-  Heater hotend(HEATER_0_PIN, TEMP_0_PIN);
-  Heater bed(HEATER_BED_PIN, TEMP_BED_PIN);
   LinearAxis x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN);
   LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN);
   LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN);
   LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
+  Heater hotend(HEATER_0_PIN, TEMP_0_PIN, hotend_model_default, Heater::hotend_celsius, FAN0_PIN, &extruder0);
+  Heater bed(HEATER_BED_PIN, TEMP_BED_PIN, bed_model_default, Heater::bed_celsius);
 
   #ifdef GPIO_LOGGING
     IOLoggerCSV logger("all_gpio_log.csv");
@@ -105,7 +108,11 @@ void simulation_loop() {
   }
 }
 
-int main() {
+int main(int argc, char *argv[]) {
+  // Deterministic benchmark of G-code files in virtual time
+  if (argc > 1 && !strcmp(argv[1], "--benchmark"))
+    return MotionBenchmark::run(argc, argv);
+
   std::thread write_serial (write_serial_thread);
   std::thread read_serial (read_serial_thread);
 
@@ -0,0 +1,79 @@
+/**
+ * Marlin 3D Printer Firmware
+ *
+ * Copyright (c) 2023 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ * Copyright (c) 2016 Bob Cousins bobcousins42@googlemail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "thermal_response.h"
+
+#include <stdio.h>
+#include <math.h>
+
+float ThermalResponse::band = 1.0f;
+
+void ThermalResponse::update(const float new_target, const float temp, const uint64_t now_ns) {
+  if (new_target != target) {
+    finish(now_ns);
+    target = new_target;
+    if (target > 0) {
+      active = true;
+      reached = false;
+      start_temp = temp;
+      overshoot = 0;
+      start_ns = exit_ns = now_ns;
+      in_band_ns = 0;
+      in_band_error = 0;
+    }
+  }
+  else if (active) {
+    // Weight each reading by the time it was held
+    const uint64_t dt = now_ns - last_ns;
+    const float error = last_temp - target,
+                toward = target >= start_temp ? error : -error;   // Positive beyond the target
+    if (!reached && toward >= -band) { reached = true; reach_ns = last_ns; }
+    if (reached && toward > overshoot) overshoot = toward;
+    if (fabsf(error) > band) {
+      exit_ns = now_ns;
+      in_band_ns = 0;
+      in_band_error = 0;
+    }
+    else {
+      in_band_ns += dt;
+      in_band_error += double(error) * dt;
+    }
+  }
+  last_temp = temp;
+  last_ns = now_ns;
+}
+
+void ThermalResponse::report(const uint64_t now_ns) {
+  printf("  %s step %.1f -> %.1fC", name, start_temp, target);
+  if (!reached) {
+    printf(": target not reached in %.1fs, ended at %.1fC\n", (now_ns - start_ns) / 1e9, last_temp);
+    return;
+  }
+  printf(": rise %.1fs, overshoot %.2fC", (reach_ns - start_ns) / 1e9, overshoot);
+  if (in_band_ns)
+    printf(", settled (+/-%.1fC) in %.1fs, steady-state error %+.3fC over %.1fs\n",
+      band, (exit_ns - start_ns) / 1e9, in_band_error / in_band_ns, in_band_ns / 1e9);
+  else
+    printf(", not settled (+/-%.1fC) after %.1fs\n", band, (now_ns - start_ns) / 1e9);
+}
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,57 @@
+/**
+ * Marlin 3D Printer Firmware
+ *
+ * Copyright (c) 2023 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ * Copyright (c) 2016 Bob Cousins bobcousins42@googlemail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Step response measurement for the simulated heaters
+ *
+ * Each time the target temperature changes, a new step starts. When it ends, or the
+ * run finishes, its rise time, overshoot, settling time and steady-state error are printed.
+ * These give a quick, repeatable comparison of PID / MPC settings against the thermal
+ * model in hardware/Heater.cpp.
+ */
+
+#include <stdint.h>
+
+class ThermalResponse {
+public:
+  static float band;          // (°C) Settled when the temperature stays this close to the target
+
+  ThermalResponse(const char * const name) : name(name) { restart(); }
+
+  // Begin a fresh measurement with the next target
+  void restart() { active = false; target = -1; }
+
+  // Called with the current target and measured temperature after each simulation event
+  void update(const float new_target, const float temp, const uint64_t now_ns);
+
+  // Report the step in progress, if any
+  void finish(const uint64_t now_ns) { if (active) report(now_ns); active = false; }
+
+private:
+  const char * const name;
+  bool active, reached;
+  float target, start_temp, last_temp, overshoot;
+  uint64_t start_ns, last_ns, reach_ns, exit_ns, in_band_ns;
+  double in_band_error;       // Integral of the error since the temperature last left the band
+
+  void report(const uint64_t now_ns);
+};
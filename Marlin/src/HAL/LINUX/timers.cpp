@@ -32,12 +32,14 @@
 
 HAL_STEP_TIMER_ISR();
 HAL_TEMP_TIMER_ISR();
+TERN_(ADC_DMA_RING, HAL_ADC_TIMER_ISR());
 
-Timer timers[2];
+Timer timers[3];
 
 void HAL_timer_init() {
   timers[0].init(0, STEPPER_TIMER_RATE, TIMER0_IRQHandler);
   timers[1].init(1, TEMP_TIMER_RATE, TIMER1_IRQHandler);
+  TERN_(ADC_DMA_RING, timers[MF_TIMER_ADC].init(MF_TIMER_ADC, ADC_TIMER_RATE, TIMER2_IRQHandler));
 }
 
 void HAL_timer_start(const uint8_t timer_num, const uint32_t frequency) {
@@ -50,6 +50,12 @@ typedef uint32_t hal_timer_t;
 #define TEMP_TIMER_RATE        1000000
 #define TEMP_TIMER_FREQUENCY   1000 // temperature interrupt frequency
 
+#ifndef MF_TIMER_ADC
+  #define MF_TIMER_ADC          2  // Timer Index for the simulated ADC DMA (ADC_DMA_RING)
+#endif
+#define ADC_TIMER_RATE         1000000
+#define ADC_TIMER_FREQUENCY    2000 // scans of all analog inputs per second
+
 #define STEPPER_TIMER_RATE     HAL_TIMER_RATE   // frequency of stepper timer (HAL_TIMER_RATE / STEPPER_TIMER_PRESCALE)
 #define STEPPER_TIMER_TICKS_PER_US ((STEPPER_TIMER_RATE) / 1000000) // stepper timer ticks per µs
 #define STEPPER_TIMER_PRESCALE (CYCLES_PER_MICROSECOND / STEPPER_TIMER_TICKS_PER_US)
@@ -71,6 +77,9 @@ typedef uint32_t hal_timer_t;
 #ifndef HAL_TEMP_TIMER_ISR
   #define HAL_TEMP_TIMER_ISR()  extern "C" void TIMER1_IRQHandler()
 #endif
+#ifndef HAL_ADC_TIMER_ISR
+  #define HAL_ADC_TIMER_ISR()   extern "C" void TIMER2_IRQHandler()
+#endif
 
 // PWM timer
 #define HAL_PWM_TIMER
@@ -318,7 +318,10 @@ enum ADCIndex : uint8_t {
   ADC_COUNT
 };
 
-static uint16_t adc_results[ADC_COUNT];
+// With ADC_DMA_RING the DMA keeps cycling through several scans of all channels
+#define ADC_SCANS TERN(ADC_DMA_RING, HAL_ADC_RING_DEPTH, 1)
+
+static uint16_t adc_results[ADC_SCANS][ADC_COUNT];
 
 // Init the AD in continuous capture mode
 void MarlinHAL::adc_init() {
@@ -350,18 +353,18 @@ void MarlinHAL::adc_init() {
   adc.calibrate();
   adc.setSampleRate((F_CPU > 72000000) ? ADC_SMPR_71_5 : ADC_SMPR_41_5); // 71.5 or 41.5 ADC cycles
   adc.setPins((uint8_t *)adc_pins, ADC_COUNT);
-  adc.setDMA(adc_results, uint16_t(ADC_COUNT), uint32_t(DMA_MINC_MODE | DMA_CIRC_MODE), nullptr);
+  adc.setDMA(adc_results[0], uint16_t(ADC_SCANS * ADC_COUNT), uint32_t(DMA_MINC_MODE | DMA_CIRC_MODE), nullptr);
   adc.setScanMode();
   adc.setContinuous();
   adc.startConversion();
 }
 
-void MarlinHAL::adc_start(const pin_t pin) {
-  #define __TCASE(N,I) case N: pin_index = I; break;
+// The position of a pin in each scan, or ADC_COUNT if it isn't scanned
+static ADCIndex adc_index(const pin_t pin) {
+  #define __TCASE(N,I) case N: return I;
   #define _TCASE(C,N,I) TERN_(C, __TCASE(N, I))
-  ADCIndex pin_index;
   switch (pin) {
-    default: return;
+    default: return ADC_COUNT;
     _TCASE(HAS_TEMP_ADC_0,        TEMP_0_PIN,                TEMP_0)
     _TCASE(HAS_TEMP_ADC_1,        TEMP_1_PIN,                TEMP_1)
     _TCASE(HAS_TEMP_ADC_2,        TEMP_2_PIN,                TEMP_2)
@@ -384,7 +387,27 @@ void MarlinHAL::adc_start(const pin_t pin) {
     _TCASE(POWER_MONITOR_CURRENT, POWER_MONITOR_CURRENT_PIN, POWERMON_CURRENT)
     _TCASE(POWER_MONITOR_VOLTAGE, POWER_MONITOR_VOLTAGE_PIN, POWERMON_VOLTS)
   }
-  adc_result = (adc_results[(int)pin_index] & 0xFFF) >> (12 - HAL_ADC_RESOLUTION); // shift out unused bits
 }
 
+#define ADC_SHIFTED(V) (((V) & 0xFFF) >> (12 - HAL_ADC_RESOLUTION)) // shift out unused bits
+
+void MarlinHAL::adc_start(const pin_t pin) {
+  const ADCIndex pin_index = adc_index(pin);
+  if (pin_index == ADC_COUNT) return;
+  adc_result = ADC_SHIFTED(adc_results[0][(int)pin_index]);
+}
+
+#if ENABLED(ADC_DMA_RING)
+
+  // The sum of every scan in the ring, for the same scale as HAL_ADC_RING_DEPTH oversampled readings
+  uint16_t MarlinHAL::adc_ring_sum(const pin_t pin) {
+    const ADCIndex pin_index = adc_index(pin);
+    if (pin_index == ADC_COUNT) return 0;
+    uint16_t sum = 0;
+    for (uint8_t i = 0; i < ADC_SCANS; ++i) sum += ADC_SHIFTED(adc_results[i][(int)pin_index]);
+    return sum;
+  }
+
+#endif
+
 #endif // __STM32F1__
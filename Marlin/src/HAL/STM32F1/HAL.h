@@ -191,6 +191,7 @@ typedef int8_t pin_t;
 #endif
 
 #define HAL_ADC_VREF         3.3
+#define HAL_ADC_RING_DEPTH   16  // Scans kept by the DMA for ADC_DMA_RING
 
 uint16_t analogRead(const pin_t pin); // need hal.adc_enable() first
 void analogWrite(const pin_t pin, int pwm_val8); // PWM only! mul by 257 in maple!?
@@ -294,6 +295,11 @@ public:
   // The current value of the ADC register
   static uint16_t adc_value() { return adc_result; }
 
+  #if ENABLED(ADC_DMA_RING)
+    // Sum of the last HAL_ADC_RING_DEPTH samples of the given pin, taken by DMA
+    static uint16_t adc_ring_sum(const pin_t pin);
+  #endif
+
   /**
    * Set the PWM duty cycle for the pin to the given value.
    * Optionally invert the duty cycle [default = false]
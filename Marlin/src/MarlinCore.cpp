@@ -257,6 +257,10 @@
   #include "feature/easythreed_ui.h"
 #endif
 
+#if ENABLED(STEP_TRACE)
+  #include "feature/step_trace.h"
+#endif
+
 #if ENABLED(MARLIN_TEST_BUILD)
   #include "tests/marlin_tests.h"
 #endif
@@ -855,7 +859,12 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   TERN_(HAS_TFT_LVGL_UI, LV_TASK_HANDLER());
 
   // Manage Fixed-time Motion Control
-  TERN_(FT_MOTION, fxdTiCtrl.loop());
+  #if ENABLED(FT_MOTION) && DISABLED(FTM_TIMER_TASK)
+    fxdTiCtrl.loop();
+  #endif
+
+  // Send the step trace
+  TERN_(STEP_TRACE, step_trace.idle());
 
   IDLE_DONE:
   TERN_(MARLIN_DEV_MODE, idle_depth--);
@@ -0,0 +1,223 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2023 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(G29_ADAPTIVE_PROBING)
+
+#include "../bedlevel.h"
+#include "../hilbert_curve.h"
+#include "../../../libs/least_squares_fit.h"
+#include "adaptive_probe.h"
+
+#if ENABLED(PROBE_PATH_PLANNER)
+  #include "../probe_path.h"
+#endif
+
+grid_count_t AdaptiveProbe::probed;
+
+// The bisection level of each mesh column and row
+static uint8_t level_x[GRID_MAX_POINTS_X], level_y[GRID_MAX_POINTS_Y];
+
+// Number the points between 'a' and 'b' by the bisection that reaches them. Return the deepest level.
+static uint8_t bisect(uint8_t * const level, const uint8_t a, const uint8_t b, const uint8_t n) {
+  if (b - a < 2) return n - 1;
+  const uint8_t m = (a + b) / 2;
+  level[m] = n;
+  return _MAX(bisect(level, a, m, n + 1), bisect(level, m, b, n + 1));
+}
+
+// The nearest index before or after 'i' with a level below 'k', or 'i' at the mesh edge
+static uint8_t prev_below(const uint8_t * const level, const uint8_t i, const uint8_t k) {
+  for (uint8_t p = i; p--;) if (level[p] < k) return p;
+  return i;
+}
+static uint8_t next_below(const uint8_t * const level, const uint8_t i, const uint8_t k, const uint8_t count) {
+  for (uint8_t n = i + 1; n < count; ++n) if (level[n] < k) return n;
+  return i;
+}
+
+// The indexes from one coarser point before 'i0' to one after 'i1'. Return the count.
+static uint8_t window(uint8_t (&w)[4], const uint8_t * const level, const uint8_t i0, const uint8_t i1, const uint8_t k, const uint8_t count) {
+  const uint8_t a = prev_below(level, i0, k), b = next_below(level, i1, k, count);
+  uint8_t n = 0;
+  w[n++] = a;
+  if (i0 != a) w[n++] = i0;
+  if (i1 != i0) w[n++] = i1;
+  if (b != i1) w[n++] = b;
+  return n;
+}
+
+typedef struct {
+  bed_mesh_t *z;
+  float tolerance;
+  uint8_t level;
+  AdaptiveProbe::probe_fn probe;
+  void *data;
+} adaptive_level_t;
+
+// Probe or interpolate a point of the current level. Return true to abort the search.
+static bool visit_point(const uint8_t x, const uint8_t y, void *data) {
+  adaptive_level_t &d = *(adaptive_level_t*)data;
+  const uint8_t k = d.level, l = _MAX(level_x[x], level_y[y]);
+
+  // The first pass probes the corners too
+  if (k > 1 ? l != k : l > 1) return false;
+
+  bed_mesh_t &z = *d.z;
+
+  // The cell of coarser points around the point. A column or row on the coarser points is the cell edge.
+  const uint8_t x0 = level_x[x] < k ? x : prev_below(level_x, x, k),
+                x1 = level_x[x] < k ? x : next_below(level_x, x, k, GRID_MAX_POINTS_X),
+                y0 = level_y[y] < k ? y : prev_below(level_y, y, k),
+                y1 = level_y[y] < k ? y : next_below(level_y, y, k, GRID_MAX_POINTS_Y);
+
+  // Fit a plane to the cell and the coarser points around it and see how far they stray from it
+  float deviation = INFINITY;
+  if (k > 1) {
+    uint8_t wx[4], wy[4];
+    const uint8_t nx = window(wx, level_x, x0, x1, k, GRID_MAX_POINTS_X),
+                  ny = window(wy, level_y, y0, y1, k, GRID_MAX_POINTS_Y);
+    linear_fit_data lsf;
+    incremental_LSF_reset(&lsf);
+    LOOP_L_N(i, nx) LOOP_L_N(j, ny) incremental_LSF(&lsf, wx[i], wy[j], z[wx[i]][wy[j]]);
+    if (!finish_incremental_LSF(&lsf)) {
+      deviation = 0;
+      LOOP_L_N(i, nx) LOOP_L_N(j, ny)
+        NOLESS(deviation, ABS(z[wx[i]][wy[j]] + lsf.A * wx[i] + lsf.B * wy[j] + lsf.D));
+    }
+  }
+
+  if (deviation > d.tolerance) {
+    #if ENABLED(PROBE_PATH_PLANNER)
+      ProbePath::add(x, y); // Probe after the level is planned
+    #else
+      const float pz = d.probe(x, y, d.data);
+      if (isnan(pz)) return true;
+      z[x][y] = pz;
+      AdaptiveProbe::probed++;
+    #endif
+  }
+  else {
+    const float tx = x1 > x0 ? float(x - x0) / (x1 - x0) : 0,
+                ty = y1 > y0 ? float(y - y0) / (y1 - y0) : 0,
+                z0 = z[x0][y0] + tx * (z[x1][y0] - z[x0][y0]),
+                z1 = z[x0][y1] + tx * (z[x1][y1] - z[x0][y1]);
+    z[x][y] = z0 + ty * (z1 - z0);
+  }
+
+  return false;
+}
+
+bool AdaptiveProbe::probe_grid(bed_mesh_t &z, const_float_t tolerance, probe_fn probe, void *data) {
+  level_x[0] = level_x[GRID_MAX_CELLS_X] = level_y[0] = level_y[GRID_MAX_CELLS_Y] = 0;
+  const uint8_t levels = _MAX(bisect(level_x, 0, GRID_MAX_CELLS_X, 1), bisect(level_y, 0, GRID_MAX_CELLS_Y, 1));
+
+  probed = 0;
+
+  // Visit each level in Hilbert curve order for short travel between the points
+  adaptive_level_t d = { &z, tolerance, 1, probe, data };
+  #if ENABLED(PROBE_PATH_PLANNER)
+    xy_pos_t from = ProbePath::position({ 0, 0 });
+  #endif
+  for (; d.level <= levels; d.level++) {
+    #if ENABLED(PROBE_PATH_PLANNER)
+      // Plan the points of the level that need probing, from where the last level ended
+      ProbePath::reset();
+      hilbert_curve::search(visit_point, &d);
+      if (d.level == 1 && ProbePath::count) from = ProbePath::position(ProbePath::points[0]);
+      ProbePath::plan(from);
+      for (grid_count_t n = 0; n < ProbePath::count; ++n) {
+        const xy_uint8_t &p = ProbePath::points[n];
+        const float pz = probe(p.x, p.y, data);
+        if (isnan(pz)) return false;
+        z[p.x][p.y] = pz;
+        probed++;
+        from = ProbePath::position(p);
+      }
+    #else
+      if (hilbert_curve::search(visit_point, &d)) return false;
+    #endif
+  }
+
+  return true;
+}
+
+#if ENABLED(MARLIN_TEST_BUILD)
+
+  #include "../../../tests/marlin_tests.h"
+
+  // A bed surface in mesh units for the test probe
+  typedef float (*test_surface_t)(const_float_t x, const_float_t y);
+
+  static float test_probe(const uint8_t x, const uint8_t y, void *data) {
+    return (*(test_surface_t*)data)(x, y);
+  }
+
+  static float abort_probe(const uint8_t x, const uint8_t y, void *data) {
+    return ++*(uint8_t*)data > 3 ? NAN : 0;
+  }
+
+  /**
+   * Probe synthetic beds. A plane must take only the first pass and come out exact.
+   * A warped bed must come out within the tolerance of the surface at every point.
+   */
+  void AdaptiveProbe::test() {
+    constexpr float tolerance = 0.02f;
+
+    auto plane = [](const_float_t x, const_float_t y) { return 0.05f * x - 0.03f * y + 0.1f; };
+    // A shallow bowl with a bump near the back right
+    auto warp = [](const_float_t x, const_float_t y) {
+      const float u = x / (GRID_MAX_CELLS_X), v = y / (GRID_MAX_CELLS_Y);
+      return 0.08f * (sq(u - 0.5f) + sq(v - 0.5f)) + 0.1f * expf(-(sq(u - 0.75f) + sq(v - 0.75f)) * 50);
+    };
+
+    static bed_mesh_t mesh;
+    uint16_t failures = 0;
+
+    test_surface_t surface = plane;
+    probe_grid(mesh, tolerance, test_probe, &surface);
+    const grid_count_t plane_probed = probed;
+    GRID_LOOP(x, y) if (ABS(mesh[x][y] - plane(x, y)) > 0.0001f && ++failures <= 5)
+      SERIAL_ECHOLNPGM("Adaptive plane mismatch: ", x, ",", y);
+    if (plane_probed > _MIN(GRID_MAX_POINTS_X, 3) * _MIN(GRID_MAX_POINTS_Y, 3)) ++failures;
+
+    surface = warp;
+    probe_grid(mesh, tolerance, test_probe, &surface);
+    const grid_count_t warp_probed = probed;
+    float warp_error = 0;
+    GRID_LOOP(x, y) NOLESS(warp_error, ABS(mesh[x][y] - warp(x, y)));
+    if (warp_error > tolerance) ++failures;
+
+    uint8_t probes = 0;
+    if (probe_grid(mesh, tolerance, abort_probe, &probes)) ++failures;
+
+    countTestFailures(failures);
+    SERIAL_ECHOPGM("Adaptive probing (", GRID_MAX_POINTS_X, "x", GRID_MAX_POINTS_Y, "): ", failures,
+                   " mismatches, plane ", plane_probed, "/", GRID_MAX_POINTS, " probed, warped bed ", warp_probed, "/", GRID_MAX_POINTS);
+    SERIAL_ECHOPAIR_F(" probed, error ", warp_error, 4);
+    SERIAL_ECHOLNPGM("mm");
+  }
+
+#endif // MARLIN_TEST_BUILD
+
+#endif // G29_ADAPTIVE_PROBING
@@ -0,0 +1,48 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2023 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/bedlevel/abl/adaptive_probe.h - Adaptive probe density for G29
+ *
+ * The grid is probed in levels of bisection: the corners, edge middles and center
+ * first, then the points halfway between those, and so on. A point of the next level
+ * is only probed if a plane fitted to the points around it misses them by more than
+ * the tolerance. Otherwise it is interpolated from the cell around it.
+ */
+
+#include "../../../inc/MarlinConfigPre.h"
+
+class AdaptiveProbe {
+public:
+  // Probe mesh point x, y and return its Z, or NAN to abort
+  typedef float (*probe_fn)(const uint8_t x, const uint8_t y, void *data);
+
+  static grid_count_t probed; // Points probed by the last probe_grid()
+
+  // Fill every point of 'z', probing where needed. Return false if probing was aborted.
+  static bool probe_grid(bed_mesh_t &z, const_float_t tolerance, probe_fn probe, void *data);
+
+  #if ENABLED(MARLIN_TEST_BUILD)
+    static void test();
+  #endif
+};
@@ -44,6 +44,13 @@ bed_mesh_t LevelingBilinear::z_values;
 xy_pos_t LevelingBilinear::cached_rel;
 xy_int8_t LevelingBilinear::cached_g;
 
+#if ENABLED(ABL_BILINEAR_BOX_CACHE)
+  LevelingBilinear::bilinear_box_t LevelingBilinear::boxes[ABL_BG_BOXES_X][ABL_BG_BOXES_Y];
+#else
+  LevelingBilinear::bilinear_box_t LevelingBilinear::last_box;
+  xy_int8_t LevelingBilinear::last_box_g;
+#endif
+
 /**
  * Extrapolate a single point from its neighbors
  */
@@ -256,179 +263,234 @@ void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values/*=nullptr
 
 #endif // ABL_BILINEAR_SUBDIVISION
 
-// Refresh after other values have been updated
-void LevelingBilinear::refresh_bed_level() {
-  TERN_(ABL_BILINEAR_SUBDIVISION, subdivide_mesh());
-  cached_rel.x = cached_rel.y = -999.999;
-  cached_g.x = cached_g.y = -99;
-}
-
 #if ENABLED(ABL_BILINEAR_SUBDIVISION)
   #define ABL_BG_SPACING(A) grid_spacing_virt.A
   #define ABL_BG_FACTOR(A)  grid_factor_virt.A
-  #define ABL_BG_POINTS_X   ABL_GRID_POINTS_VIRT_X
-  #define ABL_BG_POINTS_Y   ABL_GRID_POINTS_VIRT_Y
   #define ABL_BG_GRID(X,Y)  z_values_virt[X][Y]
 #else
   #define ABL_BG_SPACING(A) grid_spacing.A
   #define ABL_BG_FACTOR(A)  grid_factor.A
-  #define ABL_BG_POINTS_X   GRID_MAX_POINTS_X
-  #define ABL_BG_POINTS_Y   GRID_MAX_POINTS_Y
   #define ABL_BG_GRID(X,Y)  z_values[X][Y]
 #endif
 
-// Get the Z adjustment for non-linear bed leveling
-float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
+// Refresh after other values have been updated
+void LevelingBilinear::refresh_bed_level() {
+  TERN_(ABL_BILINEAR_SUBDIVISION, subdivide_mesh());
+  TERN_(MESH_BICUBIC, BicubicMesh::refresh(z_values));
+  #if ENABLED(ABL_BILINEAR_BOX_CACHE)
+    xy_int8_t g;
+    for (g.x = 0; g.x < ABL_BG_BOXES_X; ++g.x)
+      for (g.y = 0; g.y < ABL_BG_BOXES_Y; ++g.y)
+        box_from_grid(boxes[g.x][g.y], g);
+  #else
+    last_box_g.x = last_box_g.y = -99;
+  #endif
+  cached_rel.x = cached_rel.y = -999.999;
+  cached_g.x = cached_g.y = -99;
+}
 
-  static float z1, d2, z3, d4, L, D;
+/**
+ * Get the bilinear coefficients for a grid box from the Z at its corners.
+ * At the far edges the "next" grid line is the edge itself.
+ */
+void LevelingBilinear::box_from_grid(bilinear_box_t &b, const xy_int8_t &g) {
+  const uint8_t nx = _MIN(g.x + 1, ABL_BG_POINTS_X - 1), ny = _MIN(g.y + 1, ABL_BG_POINTS_Y - 1);
+  const float z1 = ABL_BG_GRID(g.x, g.y),   // left-front
+              z2 = ABL_BG_GRID(g.x, ny),    // left-back
+              z3 = ABL_BG_GRID(nx, g.y),    // right-front
+              z4 = ABL_BG_GRID(nx, ny);     // right-back
+  b.a = z1;
+  b.b = z3 - z1;
+  b.c = z2 - z1;
+  b.d = z4 - z3 - z2 + z1;
+}
 
-  static xy_pos_t ratio;
+const LevelingBilinear::bilinear_box_t& LevelingBilinear::box(const xy_int8_t &g) {
+  #if ENABLED(ABL_BILINEAR_BOX_CACHE)
+    return boxes[g.x][g.y];
+  #else
+    if (last_box_g != g) { last_box_g = g; box_from_grid(last_box, g); }
+    return last_box;
+  #endif
+}
 
-  // Whole units for the grid line indices. Constrained within bounds.
-  static xy_int8_t thisg, nextg;
+#if ENABLED(EXTRAPOLATE_BEYOND_GRID)
+  #define FAR_EDGE_OR_BOX 2   // Keep using the last grid box
+#else
+  #define FAR_EDGE_OR_BOX 1   // Just use the grid far edge
+#endif
 
-  // XY relative to the probed area
-  xy_pos_t rel = raw - grid_start.asFloat();
+/**
+ * Find the grid box for a position in grid units ('r' is the distance from the grid start
+ * over the spacing) and return the ratio within the box. 'g' is the box found last time.
+ * It is kept, without finding the box again, while the position stays inside it.
+ */
+static inline float box_ratio(const float r, const uint8_t points, int8_t &g) {
+  if (!(r >= g && r < g + 1)) g = constrain(FLOOR(r), 0, points - (FAR_EDGE_OR_BOX));
+  const float ratio = r - g;  // Subtract whole to get the ratio within the grid box
+  // Beyond the grid maintain height at grid edges. (>1 is ok at the far edge, where 'next' is 'this'.)
+  return TERN(EXTRAPOLATE_BEYOND_GRID, ratio, _MAX(ratio, 0));
+}
 
-  #if ENABLED(EXTRAPOLATE_BEYOND_GRID)
-    #define FAR_EDGE_OR_BOX 2   // Keep using the last grid box
-  #else
-    #define FAR_EDGE_OR_BOX 1   // Just use the grid far edge
-  #endif
+// Get the Z adjustment for non-linear bed leveling
+float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
 
-  if (cached_rel.x != rel.x) {
-    cached_rel.x = rel.x;
-    ratio.x = rel.x * ABL_BG_FACTOR(x);
-    const float gx = constrain(FLOOR(ratio.x), 0, ABL_BG_POINTS_X - (FAR_EDGE_OR_BOX));
-    ratio.x -= gx;      // Subtract whole to get the ratio within the grid box
+  #if ENABLED(MESH_BICUBIC)
 
-    #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
-      // Beyond the grid maintain height at grid edges
-      NOLESS(ratio.x, 0); // Never <0 (>1 is ok when nextg.x==thisg.x)
-    #endif
+    const xy_pos_t rel = raw - grid_start.asFloat();
+    return BicubicMesh::interpolate(z_values, rel.x * grid_factor.x, rel.y * grid_factor.y, ENABLED(EXTRAPOLATE_BEYOND_GRID));
 
-    thisg.x = gx;
-    nextg.x = _MIN(thisg.x + 1, ABL_BG_POINTS_X - 1);
-  }
+  #else
 
-  if (cached_rel.y != rel.y || cached_g.x != thisg.x) {
+    static float L, D;
 
-    if (cached_rel.y != rel.y) {
-      cached_rel.y = rel.y;
-      ratio.y = rel.y * ABL_BG_FACTOR(y);
-      const float gy = constrain(FLOOR(ratio.y), 0, ABL_BG_POINTS_Y - (FAR_EDGE_OR_BOX));
-      ratio.y -= gy;
+    static xy_pos_t ratio;
 
-      #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
-        // Beyond the grid maintain height at grid edges
-        NOLESS(ratio.y, 0); // Never < 0.0. (> 1.0 is ok when nextg.y==thisg.y.)
-      #endif
+    // Whole units for the grid line indices. Constrained within bounds.
+    static xy_int8_t thisg;
 
-      thisg.y = gy;
-      nextg.y = _MIN(thisg.y + 1, ABL_BG_POINTS_Y - 1);
-    }
+    // XY relative to the probed area
+    const xy_pos_t rel = raw - grid_start.asFloat();
 
-    if (cached_g != thisg) {
-      cached_g = thisg;
-      // Z at the box corners
-      z1 = ABL_BG_GRID(thisg.x, thisg.y);       // left-front
-      d2 = ABL_BG_GRID(thisg.x, nextg.y) - z1;  // left-back (delta)
-      z3 = ABL_BG_GRID(nextg.x, thisg.y);       // right-front
-      d4 = ABL_BG_GRID(nextg.x, nextg.y) - z3;  // right-back (delta)
+    if (cached_rel.x != rel.x) {
+      cached_rel.x = rel.x;
+      ratio.x = box_ratio(rel.x * ABL_BG_FACTOR(x), ABL_BG_POINTS_X, thisg.x);
     }
 
-    // Bilinear interpolate. Needed since rel.y or thisg.x has changed.
-                L = z1 + d2 * ratio.y;   // Linear interp. LF -> LB
-    const float R = z3 + d4 * ratio.y;   // Linear interp. RF -> RB
+    if (cached_rel.y != rel.y || cached_g.x != thisg.x) {
 
-    D = R - L;
-  }
+      if (cached_rel.y != rel.y) {
+        cached_rel.y = rel.y;
+        ratio.y = box_ratio(rel.y * ABL_BG_FACTOR(y), ABL_BG_POINTS_Y, thisg.y);
+      }
 
-  const float offset = L + ratio.x * D;   // the offset almost always changes
+      cached_g = thisg;
 
-  /*
-  static float last_offset = 0;
-  if (ABS(last_offset - offset) > 0.2) {
-    SERIAL_ECHOLNPGM("Sudden Shift at x=", rel.x, " / ", grid_spacing.x, " -> thisg.x=", thisg.x);
-    SERIAL_ECHOLNPGM(" y=", rel.y, " / ", grid_spacing.y, " -> thisg.y=", thisg.y);
-    SERIAL_ECHOLNPGM(" ratio.x=", ratio.x, " ratio.y=", ratio.y);
-    SERIAL_ECHOLNPGM(" z1=", z1, " z2=", z2, " z3=", z3, " z4=", z4);
-    SERIAL_ECHOLNPGM(" L=", L, " R=", R, " offset=", offset);
-  }
-  last_offset = offset;
-  //*/
+      // Interpolate along Y at the left and right of the box. Needed since rel.y or thisg.x has changed.
+      const bilinear_box_t &b = box(thisg);
+      L = b.a + b.c * ratio.y;    // LF -> LB
+      D = b.b + b.d * ratio.y;    // (RF -> RB) - L
+    }
+
+    return L + ratio.x * D;   // the offset almost always changes
 
-  return offset;
+  #endif
 }
 
-#if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
+#if DISABLED(MESH_BICUBIC) && ENABLED(MARLIN_TEST_BUILD)
 
-  #define CELL_INDEX(A,V) ((V - grid_start.A) * ABL_BG_FACTOR(A))
+  #include "../../../tests/marlin_tests.h"
 
   /**
-   * Prepare a bilinear-leveled linear move on Cartesian,
-   * splitting the move where it crosses grid borders.
+   * Check the corrections against plain bilinear interpolation of the grid corners,
+   * and time them over the segments of long diagonal moves that leave the grid.
    */
-  void LevelingBilinear::line_to_destination(const_feedRate_t scaled_fr_mm_s, uint16_t x_splits, uint16_t y_splits) {
-    // Get current and destination cells for this line
-    xy_int_t c1 { CELL_INDEX(x, current_position.x), CELL_INDEX(y, current_position.y) },
-             c2 { CELL_INDEX(x, destination.x), CELL_INDEX(y, destination.y) };
-    LIMIT(c1.x, 0, ABL_BG_POINTS_X - 2);
-    LIMIT(c1.y, 0, ABL_BG_POINTS_Y - 2);
-    LIMIT(c2.x, 0, ABL_BG_POINTS_X - 2);
-    LIMIT(c2.y, 0, ABL_BG_POINTS_Y - 2);
-
-    // Start and end in the same cell? No split needed.
-    if (c1 == c2) {
-      current_position = destination;
-      line_to_current_position(scaled_fr_mm_s);
-      return;
+  void LevelingBilinear::test_z_corrections() {
+    constexpr uint16_t test_count = 1000, test_repeat = 10;
+    constexpr float tol = 0.0001f;
+
+    // Reference: the interpolation as it was done before the box coefficients, caches included
+    auto reference = [](const xy_pos_t &raw) {
+      static xy_pos_t ratio, last_rel { -999.999, -999.999 };
+      static xy_int8_t thisg, nextg, last_g { -99, -99 };
+      static float z1, d2, z3, d4, L, D;
+      const xy_pos_t rel = raw - grid_start.asFloat();
+      if (last_rel.x != rel.x) {
+        last_rel.x = rel.x;
+        ratio.x = rel.x * ABL_BG_FACTOR(x);
+        const float gx = constrain(FLOOR(ratio.x), 0, ABL_BG_POINTS_X - (FAR_EDGE_OR_BOX));
+        ratio.x -= gx;
+        if (DISABLED(EXTRAPOLATE_BEYOND_GRID)) NOLESS(ratio.x, 0);
+        thisg.x = gx;
+        nextg.x = _MIN(thisg.x + 1, ABL_BG_POINTS_X - 1);
+      }
+      if (last_rel.y != rel.y || last_g.x != thisg.x) {
+        if (last_rel.y != rel.y) {
+          last_rel.y = rel.y;
+          ratio.y = rel.y * ABL_BG_FACTOR(y);
+          const float gy = constrain(FLOOR(ratio.y), 0, ABL_BG_POINTS_Y - (FAR_EDGE_OR_BOX));
+          ratio.y -= gy;
+          if (DISABLED(EXTRAPOLATE_BEYOND_GRID)) NOLESS(ratio.y, 0);
+          thisg.y = gy;
+          nextg.y = _MIN(thisg.y + 1, ABL_BG_POINTS_Y - 1);
+        }
+        if (last_g != thisg) {
+          last_g = thisg;
+          z1 = ABL_BG_GRID(thisg.x, thisg.y);
+          d2 = ABL_BG_GRID(thisg.x, nextg.y) - z1;
+          z3 = ABL_BG_GRID(nextg.x, thisg.y);
+          d4 = ABL_BG_GRID(nextg.x, nextg.y) - z3;
+        }
+        L = z1 + d2 * ratio.y;
+        D = z3 + d4 * ratio.y - L;
+      }
+      return L + ratio.x * D;
+    };
+
+    // Put a bumpy test mesh in place of the current one
+    static bed_mesh_t saved_z;
+    COPY(saved_z, z_values);
+    const xy_pos_t saved_spacing = grid_spacing, saved_start = grid_start;
+    set_grid({ float(X_BED_SIZE) / (GRID_MAX_CELLS_X), float(Y_BED_SIZE) / (GRID_MAX_CELLS_Y) }, { X_MIN_BED, Y_MIN_BED });
+    GRID_LOOP(x, y) z_values[x][y] = 0.1f * ((x * 7 + y * 3) % 5) - 0.2f;
+    refresh_bed_level();
+
+    // Two diagonals from 10mm outside the grid, in segments like a leveled move's
+    const xy_pos_t start[2] = { { X_MIN_BED - 10, Y_MIN_BED - 5 }, { X_MAX_BED + 10, Y_MIN_BED - 10 } },
+                   step[2] = { { (X_BED_SIZE + 20.0f) / test_count, (Y_BED_SIZE + 10.0f) / test_count },
+                               { -(X_BED_SIZE + 20.0f) / test_count, (Y_BED_SIZE + 20.0f) / test_count } };
+
+    // Accuracy of the corrections
+    uint16_t failures = 0;
+    float max_error = 0;
+    LOOP_L_N(l, 2) {
+      xy_pos_t p = start[l];
+      for (uint16_t i = 0; i < test_count; ++i) {
+        p += step[l];
+        const float ref = reference(p), z = get_z_correction(p), error = ABS(z - ref);
+        NOLESS(max_error, error);
+        if (error > tol && ++failures <= 5)
+          SERIAL_ECHOLNPGM("Bilinear mismatch: X", p.x, " Y", p.y, " ref=", ref, " z=", z);
+      }
     }
 
-    #define LINE_SEGMENT_END(A) (current_position.A + (destination.A - current_position.A) * normalized_dist)
-
-    float normalized_dist;
-    xyze_pos_t end;
-    const xy_int8_t gc { _MAX(c1.x, c2.x), _MAX(c1.y, c2.y) };
-
-    // Crosses on the X and not already split on this X?
-    // The x_splits flags are insurance against rounding errors.
-    if (c2.x != c1.x && TEST(x_splits, gc.x)) {
-      // Split on the X grid line
-      CBI(x_splits, gc.x);
-      end = destination;
-      destination.x = grid_start.x + ABL_BG_SPACING(x) * gc.x;
-      normalized_dist = (destination.x - current_position.x) / (end.x - current_position.x);
-      destination.y = LINE_SEGMENT_END(y);
-    }
-    // Crosses on the Y and not already split on this Y?
-    else if (c2.y != c1.y && TEST(y_splits, gc.y)) {
-      // Split on the Y grid line
-      CBI(y_splits, gc.y);
-      end = destination;
-      destination.y = grid_start.y + ABL_BG_SPACING(y) * gc.y;
-      normalized_dist = (destination.y - current_position.y) / (end.y - current_position.y);
-      destination.x = LINE_SEGMENT_END(x);
-    }
-    else {
-      // Must already have been split on these border(s)
-      // This should be a rare case.
-      current_position = destination;
-      line_to_current_position(scaled_fr_mm_s);
-      return;
-    }
+    // Speed of the corrections and the reference over the same points
+    volatile float sink = 0;
+    auto time_single = [&](float (*fn)(const xy_pos_t&)) {
+      const uint32_t t = testMicros();
+      LOOP_L_N(l, 2 * test_repeat) {
+        xy_pos_t p = start[l & 1];
+        for (uint16_t i = 0; i < test_count; ++i) { p += step[l & 1]; sink += fn(p); }
+      }
+      return testMicros() - t;
+    };
+    const uint32_t reference_us = time_single(reference),
+                   single_us = time_single(get_z_correction);
+
+    countTestFailures(failures);
+    SERIAL_ECHOPGM("Bilinear corrections (", TERN(ABL_BILINEAR_BOX_CACHE, "box cache", "no cache"), "): ", 2 * test_count, " points, ", failures, " mismatches");
+    SERIAL_ECHOPAIR_F(", max error ", max_error, 6);
+    SERIAL_ECHOPGM("mm, x", test_repeat, " ", single_us, "us");
+    SERIAL_ECHOLNPGM(" (reference ", reference_us, "us)");
+
+    // Put the mesh back
+    COPY(z_values, saved_z);
+    set_grid(saved_spacing, saved_start);
+    refresh_bed_level();
+  }
 
-    destination.z = LINE_SEGMENT_END(z);
-    destination.e = LINE_SEGMENT_END(e);
+#endif // !MESH_BICUBIC && MARLIN_TEST_BUILD
 
-    // Do the split and look for more borders
-    line_to_destination(scaled_fr_mm_s, x_splits, y_splits);
+#if HAS_MESH_LINE_SPLIT
 
-    // Restore destination from stack
-    destination = end;
-    line_to_destination(scaled_fr_mm_s, x_splits, y_splits);
+  /**
+   * Prepare a bilinear-leveled linear move on Cartesian,
+   * splitting the move where it crosses grid borders.
+   */
+  void LevelingBilinear::line_to_destination(const_feedRate_t scaled_fr_mm_s) {
+    mesh_line_to_destination(scaled_fr_mm_s, grid_start, { ABL_BG_SPACING(x), ABL_BG_SPACING(y) }, { ABL_BG_POINTS_X - 1, ABL_BG_POINTS_Y - 1 });
   }
 
-#endif // IS_CARTESIAN && !SEGMENT_LEVELED_MOVES
+#endif // HAS_MESH_LINE_SPLIT
 
 #endif // AUTO_BED_LEVELING_BILINEAR
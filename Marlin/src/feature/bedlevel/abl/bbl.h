@@ -47,8 +47,31 @@ private:
     static float virt_cmr(const float p[4], const uint8_t i, const float t);
     static float virt_2cmr(const uint8_t x, const uint8_t y, const_float_t tx, const_float_t ty);
     static void subdivide_mesh();
+
+    #define ABL_BG_POINTS_X ABL_GRID_POINTS_VIRT_X
+    #define ABL_BG_POINTS_Y ABL_GRID_POINTS_VIRT_Y
+  #else
+    #define ABL_BG_POINTS_X GRID_MAX_POINTS_X
+    #define ABL_BG_POINTS_Y GRID_MAX_POINTS_Y
+  #endif
+
+  // Boxes that corrections are taken from. Without EXTRAPOLATE_BEYOND_GRID the far edge is a box of its own.
+  #define ABL_BG_BOXES_X (ABL_BG_POINTS_X - ENABLED(EXTRAPOLATE_BEYOND_GRID))
+  #define ABL_BG_BOXES_Y (ABL_BG_POINTS_Y - ENABLED(EXTRAPOLATE_BEYOND_GRID))
+
+  // Z = a + b * ratio.x + c * ratio.y + d * ratio.x * ratio.y within a grid box
+  typedef struct { float a, b, c, d; } bilinear_box_t;
+
+  #if ENABLED(ABL_BILINEAR_BOX_CACHE)
+    static bilinear_box_t boxes[ABL_BG_BOXES_X][ABL_BG_BOXES_Y];
+  #else
+    static bilinear_box_t last_box;   // Only the last box is kept
+    static xy_int8_t last_box_g;
   #endif
 
+  static const bilinear_box_t& box(const xy_int8_t &g);
+  static void box_from_grid(bilinear_box_t &b, const xy_int8_t &g);
+
 public:
   static void reset();
   static void set_grid(const xy_pos_t& _grid_spacing, const xy_pos_t& _grid_start);
@@ -60,10 +83,14 @@ public:
   static float get_mesh_x(const uint8_t i) { return grid_start.x + i * grid_spacing.x; }
   static float get_mesh_y(const uint8_t j) { return grid_start.y + j * grid_spacing.y; }
   static float get_z_correction(const xy_pos_t &raw);
+
+  #if ENABLED(MARLIN_TEST_BUILD) && DISABLED(MESH_BICUBIC)
+    static void test_z_corrections();
+  #endif
   static constexpr float get_z_offset() { return 0.0f; }
 
-  #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
-    static void line_to_destination(const_feedRate_t scaled_fr_mm_s, uint16_t x_splits=0xFFFF, uint16_t y_splits=0xFFFF);
+  #if HAS_MESH_LINE_SPLIT
+    static void line_to_destination(const_feedRate_t scaled_fr_mm_s);
   #endif
 };
 
@@ -27,7 +27,7 @@
 #include "bedlevel.h"
 #include "../../module/planner.h"
 
-#if EITHER(MESH_BED_LEVELING, PROBE_MANUALLY)
+#if ANY(MESH_BED_LEVELING, PROBE_MANUALLY, HAS_MESH_LINE_SPLIT)
   #include "../../module/motion.h"
 #endif
 
@@ -75,6 +75,11 @@ void set_bed_leveling_enabled(const bool enable/*=true*/) {
     _report_leveling();
     planner.synchronize();
 
+    // UBL edits the mesh in many places, so pick up any changes here
+    #if BOTH(AUTO_BED_LEVELING_UBL, MESH_BICUBIC)
+      if (enable) bedlevel.refresh_bed_level();
+    #endif
+
     // Get the corrected leveled / unleveled position
     planner.apply_modifiers(current_position, true);    // Physical position with all modifiers
     planner.leveling_active ^= true;                    // Toggle leveling between apply and unapply
@@ -188,6 +193,49 @@ void reset_bed_level() {
 
 #endif // AUTO_BED_LEVELING_BILINEAR || MESH_BED_LEVELING
 
+#if HAS_MESH_LINE_SPLIT
+
+  /**
+   * Move from current_position to destination with one planner line per mesh cell,
+   * split where the move crosses the grid lines at 'first' + n * 'spacing' (n = 0 to 'cells').
+   * The crossings are visited in order along the move, so there are only as many lines
+   * as cells crossed, and the correction between the ends of each line is straight.
+   * The mesh edges count too, since beyond them the correction may hold the edge height.
+   */
+  void mesh_line_to_destination(const_feedRate_t scaled_fr_mm_s, const xy_pos_t &first, const xy_pos_t &spacing, const xy_uint8_t &cells) {
+    const xyze_pos_t start = current_position;
+    const xyze_float_t diff = destination - start;
+
+    // The next grid line on each axis and its distance along the move (0-1), 2 for none
+    xy_int8_t line, dir;
+    xy_float_t t;
+    auto line_t = [&](const AxisEnum a) {
+      return dir[a] && WITHIN(line[a], 0, cells[a]) ? (first[a] + line[a] * spacing[a] - start[a]) / diff[a] : 2.0f;
+    };
+    LOOP_L_N(a, 2) {
+      dir[a] = diff[a] > 0 ? 1 : diff[a] < 0 ? -1 : 0;
+      // Outside the mesh counts as the cell next to it
+      const int8_t cell = constrain(FLOOR((start[a] - first[a]) / spacing[a]), -1, cells[a]);
+      line[a] = cell + (dir[a] > 0);
+      t[a] = line_t(AxisEnum(a));
+    }
+
+    for (;;) {
+      const float tt = _MIN(t.x, t.y);
+      if (tt >= 1) break;
+      if (tt > 0) planner.buffer_line(start + diff * tt, scaled_fr_mm_s);  // Not a line the move starts on
+      LOOP_L_N(a, 2) if (t[a] == tt) {
+        line[a] += dir[a];
+        t[a] = line_t(AxisEnum(a));
+      }
+    }
+
+    current_position = destination;
+    line_to_current_position(scaled_fr_mm_s);
+  }
+
+#endif // HAS_MESH_LINE_SPLIT
+
 #if EITHER(MESH_BED_LEVELING, PROBE_MANUALLY)
 
   void _manual_goto_xy(const xy_pos_t &pos) {
@@ -61,6 +61,15 @@ class TemporaryBedLevelingState {
 
   typedef float bed_mesh_t[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
 
+  #if IS_CARTESIAN && EITHER(MESH_BED_LEVELING, AUTO_BED_LEVELING_BILINEAR)
+    #define HAS_MESH_LINE_SPLIT 1
+    void mesh_line_to_destination(const_feedRate_t scaled_fr_mm_s, const xy_pos_t &first, const xy_pos_t &spacing, const xy_uint8_t &cells);
+  #endif
+
+  #if ENABLED(MESH_BICUBIC)
+    #include "bicubic.h"
+  #endif
+
   #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
     #include "abl/bbl.h"
   #elif ENABLED(AUTO_BED_LEVELING_UBL)
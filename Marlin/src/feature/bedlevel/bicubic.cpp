@@ -0,0 +1,168 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2023 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(MESH_BICUBIC)
+
+#include "bedlevel.h"
+
+mesh_slope_t BicubicMesh::slopes[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+
+/**
+ * Catmull-Rom slope at a point: half the difference of its neighbors.
+ * At the mesh edges, or next to an unprobed point, the slope toward the one neighbor.
+ */
+static float cmr_slope(const_float_t prev, const_float_t here, const_float_t next) {
+  if (isnan(here)) return 0;
+  if (!isnan(prev) && !isnan(next)) return (next - prev) * 0.5f;
+  if (!isnan(next)) return next - here;
+  if (!isnan(prev)) return here - prev;
+  return 0;
+}
+
+void BicubicMesh::refresh(const bed_mesh_t &z) {
+  GRID_LOOP(x, y) {
+    mesh_slope_t &s = slopes[x][y];
+    s.dx = cmr_slope(x ? z[x - 1][y] : NAN, z[x][y], x < GRID_MAX_CELLS_X ? z[x + 1][y] : NAN);
+    s.dy = cmr_slope(y ? z[x][y - 1] : NAN, z[x][y], y < GRID_MAX_CELLS_Y ? z[x][y + 1] : NAN);
+  }
+  // The twist is the Y slope of the X slopes
+  GRID_LOOP(x, y)
+    slopes[x][y].dxy = cmr_slope(y ? slopes[x][y - 1].dx : NAN, slopes[x][y].dx, y < GRID_MAX_CELLS_Y ? slopes[x][y + 1].dx : NAN);
+}
+
+// Cubic Hermite weights at 't' (0-1) of the end values and end slopes
+struct hermite_t {
+  float p0, p1, m0, m1;
+  hermite_t(const_float_t t) {
+    const float t2 = sq(t), t3 = t2 * t;
+    p1 = 3 * t2 - 2 * t3;
+    p0 = 1 - p1;
+    m0 = t3 - 2 * t2 + t;
+    m1 = t3 - t2;
+  }
+  float blend(const_float_t a, const_float_t b, const_float_t da, const_float_t db) const {
+    return p0 * a + p1 * b + m0 * da + m1 * db;
+  }
+};
+
+float BicubicMesh::interpolate(const bed_mesh_t &z, const_float_t rx, const_float_t ry, const bool extrapolate) {
+  const int8_t cx = constrain(FLOOR(rx), 0, GRID_MAX_CELLS_X - 1),
+               cy = constrain(FLOOR(ry), 0, GRID_MAX_CELLS_Y - 1);
+
+  // The position within the cell, and how far beyond the mesh edge it is
+  float tx = rx - cx, ty = ry - cy;
+  const float ex = tx - constrain(tx, 0, 1), ey = ty - constrain(ty, 0, 1);
+  tx -= ex; ty -= ey;
+
+  const mesh_slope_t &s00 = slopes[cx][cy],     &s10 = slopes[cx + 1][cy],
+                     &s01 = slopes[cx][cy + 1], &s11 = slopes[cx + 1][cy + 1];
+  const hermite_t hx(tx), hy(ty);
+
+  // Z and its Y slope at 'tx' along the front and back of the cell, then Z at 'ty' between them
+  const float z0 = hx.blend(z[cx][cy],     z[cx + 1][cy],     s00.dx, s10.dx),
+              z1 = hx.blend(z[cx][cy + 1], z[cx + 1][cy + 1], s01.dx, s11.dx),
+              d0 = hx.blend(s00.dy, s10.dy, s00.dxy, s10.dxy),
+              d1 = hx.blend(s01.dy, s11.dy, s01.dxy, s11.dxy);
+  float zz = hy.blend(z0, z1, d0, d1);
+
+  // Continue the slopes across the mesh edge
+  if (extrapolate) {
+    if (ex) {
+      const mesh_slope_t &f = ex < 0 ? s00 : s10, &b = ex < 0 ? s01 : s11;
+      zz += ex * hy.blend(f.dx, b.dx, f.dxy, b.dxy);
+    }
+    if (ey) zz += ey * (ey < 0 ? d0 : d1);
+  }
+
+  return zz;
+}
+
+#if ENABLED(MARLIN_TEST_BUILD)
+
+  #include "../../tests/marlin_tests.h"
+
+  /**
+   * Check the patches against surfaces sampled on the mesh. A plane and the mesh points must
+   * come out exact. A warped bed should come out closer than with bilinear interpolation.
+   */
+  void BicubicMesh::test() {
+    constexpr uint16_t test_count = 1000;
+    constexpr float tol = 0.0001f;
+
+    // Surfaces over the mesh, in mesh units
+    auto plane = [](const_float_t x, const_float_t y) { return 0.05f * x - 0.03f * y + 0.1f; };
+    auto warp = [](const_float_t x, const_float_t y) {
+      const float u = x / (GRID_MAX_CELLS_X), v = y / (GRID_MAX_CELLS_Y);
+      return 0.3f * sq(u - 0.4f) - 0.2f * u * v + 0.15f * sinf(3.0f * u) * cosf(2.5f * v);
+    };
+    auto bilinear = [](const bed_mesh_t &z, const_float_t rx, const_float_t ry) {
+      const int8_t cx = constrain(FLOOR(rx), 0, GRID_MAX_CELLS_X - 1), cy = constrain(FLOOR(ry), 0, GRID_MAX_CELLS_Y - 1);
+      const float tx = rx - cx, ty = ry - cy,
+                  z0 = z[cx][cy] + tx * (z[cx + 1][cy] - z[cx][cy]),
+                  z1 = z[cx][cy + 1] + tx * (z[cx + 1][cy + 1] - z[cx][cy + 1]);
+      return z0 + ty * (z1 - z0);
+    };
+
+    static bed_mesh_t mesh;
+    uint16_t failures = 0;
+
+    // A plane, also a cell beyond the mesh
+    GRID_LOOP(x, y) mesh[x][y] = plane(x, y);
+    refresh(mesh);
+    float plane_error = 0;
+    for (uint16_t i = 0; i < test_count; ++i) {
+      const float rx = (i % 40) * (GRID_MAX_CELLS_X + 2) / 39.0f - 1, ry = (i / 40) * (GRID_MAX_CELLS_Y + 2) / 24.0f - 1;
+      const float error = ABS(interpolate(mesh, rx, ry, true) - plane(rx, ry));
+      NOLESS(plane_error, error);
+      if (error > tol && ++failures <= 5) SERIAL_ECHOLNPGM("Bicubic plane mismatch: ", rx, ",", ry);
+    }
+
+    // A warped bed, and its mesh points
+    GRID_LOOP(x, y) mesh[x][y] = warp(x, y);
+    refresh(mesh);
+    GRID_LOOP(x, y) if (ABS(interpolate(mesh, x, y, false) - mesh[x][y]) > tol && ++failures <= 5)
+      SERIAL_ECHOLNPGM("Bicubic mesh point mismatch: ", x, ",", y);
+    float cubic_error = 0, linear_error = 0;
+    for (uint16_t i = 0; i < test_count; ++i) {
+      const float rx = (i % 40) * (GRID_MAX_CELLS_X) / 39.0f, ry = (i / 40) * (GRID_MAX_CELLS_Y) / 24.0f,
+                  zw = warp(rx, ry);
+      NOLESS(cubic_error, ABS(interpolate(mesh, rx, ry, false) - zw));
+      NOLESS(linear_error, ABS(bilinear(mesh, rx, ry) - zw));
+    }
+    if (cubic_error >= linear_error) ++failures;
+
+    countTestFailures(failures);
+    SERIAL_ECHOPGM("Bicubic mesh (", GRID_MAX_POINTS_X, "x", GRID_MAX_POINTS_Y, "): ", failures, " mismatches");
+    SERIAL_ECHOPAIR_F(", plane error ", plane_error, 6);
+    SERIAL_ECHOPAIR_F("mm, warped bed error ", cubic_error, 4);
+    SERIAL_ECHOPAIR_F("mm (bilinear ", linear_error, 4);
+    SERIAL_ECHOLNPGM("mm)");
+
+    // Back to the slopes of the real mesh
+    refresh(bedlevel.z_values);
+  }
+
+#endif // MARLIN_TEST_BUILD
+
+#endif // MESH_BICUBIC
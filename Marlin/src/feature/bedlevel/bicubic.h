@@ -0,0 +1,53 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2023 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/bedlevel/bicubic.h - Bicubic patches over a bed mesh
+ *
+ * Each mesh cell is a bicubic (Hermite) patch through its four corner points, shaped by the
+ * slopes at those points. The slopes are Catmull-Rom, as used by ABL_BILINEAR_SUBDIVISION,
+ * so the surface is the one that subdivision approaches, without the subdivided grid.
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+// Slopes at a mesh point, in Z per mesh cell
+typedef struct { float dx, dy, dxy; } mesh_slope_t;
+
+class BicubicMesh {
+public:
+  static mesh_slope_t slopes[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+
+  // Get the slopes at every mesh point. Call whenever the mesh changes.
+  static void refresh(const bed_mesh_t &z);
+
+  /**
+   * Z at a position in mesh units (the distance from the first mesh point over the spacing).
+   * Beyond the mesh the edge height is held, or with 'extrapolate' the edge slope continues.
+   */
+  static float interpolate(const bed_mesh_t &z, const_float_t rx, const_float_t ry, const bool extrapolate);
+
+  #if ENABLED(MARLIN_TEST_BUILD)
+    static void test();
+  #endif
+};
@@ -26,7 +26,9 @@ class hilbert_curve {
     typedef bool (*callback_ptr)(uint8_t x, uint8_t y, void *data);
     static bool search(callback_ptr func, void *data);
     static bool search_from(uint8_t x, uint8_t y, callback_ptr func, void *data);
-    static bool search_from_closest(const xy_pos_t &pos, callback_ptr func, void *data);
+    #if ENABLED(UBL_HILBERT_CURVE)
+      static bool search_from_closest(const xy_pos_t &pos, callback_ptr func, void *data);
+    #endif
   private:
     static bool hilbert(int8_t x, int8_t y, int8_t xi, int8_t xj, int8_t yi, int8_t yj, uint8_t n, callback_ptr func, void *data);
 };
@@ -117,8 +117,10 @@ public:
     return zf;
   }
 
-  #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
-    static void line_to_destination(const_feedRate_t scaled_fr_mm_s, uint8_t x_splits=0xFF, uint8_t y_splits=0xFF);
+  #if HAS_MESH_LINE_SPLIT
+    static void line_to_destination(const_feedRate_t scaled_fr_mm_s) {
+      mesh_line_to_destination(scaled_fr_mm_s, { MESH_MIN_X, MESH_MIN_Y }, { MESH_X_DIST, MESH_Y_DIST }, { GRID_MAX_CELLS_X, GRID_MAX_CELLS_Y });
+    }
   #endif
 };
 
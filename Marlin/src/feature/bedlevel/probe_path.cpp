@@ -0,0 +1,164 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2023 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(PROBE_PATH_PLANNER)
+
+#include "probe_path.h"
+#include "hilbert_curve.h"
+#include "../../module/planner.h"
+
+// Passes of 2-opt over the whole path, at most
+#define PROBE_PATH_PASSES 8
+
+xy_uint8_t ProbePath::points[GRID_MAX_POINTS];
+grid_count_t ProbePath::count;
+float ProbePath::default_time, ProbePath::planned_time;
+xy_pos_t ProbePath::origin;
+xy_float_t ProbePath::spacing;
+feedRate_t ProbePath::feedrate;
+
+void ProbePath::set_grid(const xy_pos_t &o, const xy_float_t &s, const_feedRate_t fr_mm_s) {
+  origin = o;
+  spacing = s;
+  feedrate = fr_mm_s;
+  default_time = planned_time = 0;
+}
+
+/**
+ * Time to move from 'a' to 'b' from rest to rest. The feedrate and the acceleration
+ * are limited by each axis in proportion to its share of the move, as in the planner.
+ */
+float ProbePath::move_time(const xy_pos_t &a, const xy_pos_t &b) {
+  const xy_float_t d = b - a;
+  const float len = d.magnitude();
+  if (len < 0.001f) return 0;
+
+  float v = feedrate, acc = planner.settings.travel_acceleration;
+  LOOP_L_N(axis, 2) {
+    const float u = ABS(d[axis]) / len;
+    if (u > 0.001f) {
+      NOMORE(v, planner.settings.max_feedrate_mm_s[axis] / u);
+      NOMORE(acc, planner.settings.max_acceleration_mm_per_s2[axis] / u);
+    }
+  }
+
+  // A triangle if 'v' can't be reached, otherwise a trapezoid
+  return len * acc < sq(v) ? 2 * SQRT(len / acc) : len / v + v / acc;
+}
+
+float ProbePath::path_time(const xy_pos_t &start, const grid_count_t first/*=0*/) {
+  float t = 0;
+  xy_pos_t from = start;
+  for (grid_count_t i = first; i < count; ++i) {
+    const xy_pos_t to = position(points[i]);
+    t += move_time(from, to);
+    from = to;
+  }
+  return t;
+}
+
+static void swap_points(const grid_count_t a, const grid_count_t b) {
+  const xy_uint8_t p = ProbePath::points[a];
+  ProbePath::points[a] = ProbePath::points[b];
+  ProbePath::points[b] = p;
+}
+
+typedef struct {
+  bool seed;          // Move the points into Hilbert curve order, or just time that order
+  grid_count_t first, // Points before this one keep their place
+               next;  // Points found so far, counting those before 'first'
+  xy_pos_t from;
+  float time;
+} hilbert_path_t;
+
+// Time the path to a point found on the Hilbert curve, and move it after the points found before
+static bool hilbert_point(const uint8_t x, const uint8_t y, void *data) {
+  hilbert_path_t &h = *(hilbert_path_t*)data;
+  for (grid_count_t i = h.seed ? h.next : h.first; i < ProbePath::count; ++i) {
+    if (ProbePath::points[i].x == x && ProbePath::points[i].y == y) {
+      const xy_pos_t to = ProbePath::position(ProbePath::points[i]);
+      h.time += ProbePath::move_time(h.from, to);
+      h.from = to;
+      if (h.seed && i != h.next) swap_points(i, h.next);
+      ++h.next;
+      break;
+    }
+  }
+  return h.next >= ProbePath::count;
+}
+
+void ProbePath::plan(const xy_pos_t &start, const grid_count_t keep/*=0*/) {
+  if (count <= keep) return;
+
+  const float old_time = path_time(start);
+
+  // Start from the Hilbert curve through the point nearest the start, if it beats the usual order
+  const xy_pos_t from = keep ? position(points[keep - 1]) : start;
+  const xy_uint8_t nearest = {
+    uint8_t(LROUND(constrain((from.x - origin.x) / spacing.x, 0, GRID_MAX_CELLS_X))),
+    uint8_t(LROUND(constrain((from.y - origin.y) / spacing.y, 0, GRID_MAX_CELLS_Y)))
+  };
+  hilbert_path_t h = { false, keep, keep, from, 0 };
+  hilbert_curve::search_from(nearest.x, nearest.y, hilbert_point, &h);
+  if (h.time < path_time(from, keep)) {
+    h = { true, keep, keep, from, 0 };
+    hilbert_curve::search_from(nearest.x, nearest.y, hilbert_point, &h);
+  }
+
+  // Reverse the stretch from i to j wherever that saves time. The end of the path is free.
+  for (uint8_t pass = 0; pass < PROBE_PATH_PASSES; ++pass) {
+    bool improved = false;
+    for (grid_count_t i = keep; i + 1 < count; ++i) {
+      const xy_pos_t before = i ? position(points[i - 1]) : start, pi = position(points[i]);
+      const float t_before = move_time(before, pi);
+      for (grid_count_t j = i + 1; j < count; ++j) {
+        const xy_pos_t pj = position(points[j]);
+        float saved = t_before - move_time(before, pj);
+        if (j + 1 < count) {
+          const xy_pos_t after = position(points[j + 1]);
+          saved += move_time(pj, after) - move_time(pi, after);
+        }
+        if (saved > 0.001f) {
+          for (grid_count_t a = i, b = j; a < b; ++a, --b) swap_points(a, b);
+          improved = true;
+          break;
+        }
+      }
+      idle_no_sleep();
+    }
+    if (!improved) break;
+  }
+
+  default_time += old_time;
+  planned_time += path_time(start);
+}
+
+void ProbePath::report(const millis_t start_ms) {
+  SERIAL_ECHOPAIR_F("Planned travel ", planned_time, 1);
+  SERIAL_ECHOPAIR_F("s, saving ", default_time - planned_time, 1);
+  SERIAL_ECHOPAIR_F("s (estimated). Took ", MS_TO_SEC_PRECISE(millis() - start_ms), 1);
+  SERIAL_ECHOLNPGM("s.");
+}
+
+#endif // PROBE_PATH_PLANNER
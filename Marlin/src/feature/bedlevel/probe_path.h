@@ -0,0 +1,67 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2023 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/bedlevel/probe_path.h - Travel-optimized order of mesh points
+ *
+ * The points are added in the order the caller would normally visit them. The path
+ * starts along the Hilbert curve from the point nearest the start position, and is
+ * then improved by reversing stretches of it (2-opt) while that saves travel time.
+ * Travel time is estimated for a stop at each point, with the feedrate and the
+ * acceleration limited by the axis limits in the direction of each move.
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+class ProbePath {
+public:
+  static xy_uint8_t points[GRID_MAX_POINTS];
+  static grid_count_t count;
+
+  // Estimated travel seconds for the points in the order added and in the planned order
+  static float default_time, planned_time;
+
+  // Set the mesh geometry and the feedrate for moves between points. Clear the estimates.
+  static void set_grid(const xy_pos_t &origin, const xy_float_t &spacing, const_feedRate_t fr_mm_s);
+
+  static xy_pos_t position(const xy_uint8_t &p) { return origin + spacing * p.asFloat(); }
+
+  static void reset() { count = 0; }
+  static void add(const uint8_t x, const uint8_t y) { points[count++].set(x, y); }
+
+  // Reorder the points for the least travel time from 'start', leaving the first 'keep' in place
+  static void plan(const xy_pos_t &start, const grid_count_t keep=0);
+
+  // Time to move from 'a' to 'b', stopping at both
+  static float move_time(const xy_pos_t &a, const xy_pos_t &b);
+
+  // Report the estimated travel and saving along with the actual time since 'start_ms'
+  static void report(const millis_t start_ms);
+
+private:
+  static xy_pos_t origin;
+  static xy_float_t spacing;
+  static feedRate_t feedrate;
+
+  static float path_time(const xy_pos_t &start, const grid_count_t first=0);
+};
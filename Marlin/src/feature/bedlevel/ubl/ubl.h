@@ -250,11 +250,9 @@ public:
    * This is the generic Z-Correction. It works anywhere within a Mesh Cell. It first
    * does a linear interpolation along both of the bounding X-Mesh-Lines to find the
    * Z-Height at both ends. Then it does a linear interpolation of these heights based
-   * on the Y position within the cell.
+   * on the Y position within the cell. With MESH_BICUBIC it's the cell's bicubic patch.
    */
   static float get_z_correction(const_float_t rx0, const_float_t ry0) {
-    const int8_t cx = cell_index_x(rx0), cy = cell_index_y(ry0); // return values are clamped
-
     /**
      * Check if the requested location is off the mesh.  If so, and
      * UBL_Z_RAISE_WHEN_OFF_MESH is specified, that value is returned.
@@ -264,11 +262,16 @@ public:
         return UBL_Z_RAISE_WHEN_OFF_MESH;
     #endif
 
-    const uint8_t mx = _MIN(cx, (GRID_MAX_POINTS_X) - 2) + 1, my = _MIN(cy, (GRID_MAX_POINTS_Y) - 2) + 1;
-    const float x0 = get_mesh_x(cx), x1 = get_mesh_x(cx + 1),
-                z1 = calc_z0(rx0, x0, z_values[cx][cy], x1, z_values[mx][cy]),
-                z2 = calc_z0(rx0, x0, z_values[cx][my], x1, z_values[mx][my]);
-    float z0 = calc_z0(ry0, get_mesh_y(cy), z1, get_mesh_y(cy + 1), z2);
+    #if ENABLED(MESH_BICUBIC)
+      float z0 = BicubicMesh::interpolate(z_values, (rx0 - (MESH_MIN_X)) * RECIPROCAL(MESH_X_DIST), (ry0 - (MESH_MIN_Y)) * RECIPROCAL(MESH_Y_DIST), true);
+    #else
+      const int8_t cx = cell_index_x(rx0), cy = cell_index_y(ry0); // return values are clamped
+      const uint8_t mx = _MIN(cx, (GRID_MAX_POINTS_X) - 2) + 1, my = _MIN(cy, (GRID_MAX_POINTS_Y) - 2) + 1;
+      const float x0 = get_mesh_x(cx), x1 = get_mesh_x(cx + 1),
+                  z1 = calc_z0(rx0, x0, z_values[cx][cy], x1, z_values[mx][cy]),
+                  z2 = calc_z0(rx0, x0, z_values[cx][my], x1, z_values[mx][my]);
+      float z0 = calc_z0(ry0, get_mesh_y(cy), z1, get_mesh_y(cy + 1), z2);
+    #endif
 
     if (isnan(z0)) { // If part of the Mesh is undefined, it will show up as NAN
       z0 = 0.0;      // in z_values[][] and propagate through the calculations.
@@ -290,6 +293,9 @@ public:
 
   static constexpr float get_z_offset() { return 0.0f; }
 
+  // Update anything derived from the mesh after it changes
+  static void refresh_bed_level() { TERN_(MESH_BICUBIC, BicubicMesh::refresh(z_values)); }
+
   static float get_mesh_x(const uint8_t i) {
     return i < (GRID_MAX_POINTS_X) ? pgm_read_float(&_mesh_index_to_xpos[i]) : MESH_MIN_X + i * (MESH_X_DIST);
   }
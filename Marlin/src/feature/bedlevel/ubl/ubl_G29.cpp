@@ -52,6 +52,10 @@
   #include "../hilbert_curve.h"
 #endif
 
+#if ENABLED(PROBE_PATH_PLANNER)
+  #include "../probe_path.h"
+#endif
+
 #include <math.h>
 
 #define UBL_G29_P31
@@ -762,6 +766,30 @@ void unified_bed_leveling::shift_mesh_height() {
     save_ubl_active_state_and_disable();  // No bed level correction so only raw data is obtained
     grid_count_t count = GRID_MAX_POINTS;
 
+    #if ENABLED(PROBE_PATH_PLANNER)
+      // Take the reachable invalid points in the usual order, then plan the path through them
+      const millis_t start_ms = millis();
+      grid_count_t path_index = 0;
+      if (!do_furthest) {
+        MeshFlags done;
+        done.reset();
+        GRID_LOOP(i, j) if (!isnan(z_values[i][j])) done.mark(i, j);
+        ProbePath::reset();
+        // The search favors points near the nozzle, so follow it from point to point
+        const xyz_pos_t saved_position = current_position;
+        for (;;) {
+          mesh_index_pair p = find_closest_mesh_point_of_type(SET_IN_BITMAP, nearby, true, &done);
+          if (!p.valid()) break;
+          done.mark(p.pos);
+          ProbePath::add(p.pos.x, p.pos.y);
+          current_position = p.meshpos() - probe.offset_xy;
+        }
+        current_position = saved_position;
+        ProbePath::set_grid({ MESH_MIN_X, MESH_MIN_Y }, { MESH_X_DIST, MESH_Y_DIST }, XY_PROBE_FEEDRATE_MM_S);
+        ProbePath::plan(xy_pos_t(current_position) + probe.offset_xy);
+      }
+    #endif
+
     mesh_index_pair best;
     TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::G29_START));
     do {
@@ -784,6 +812,17 @@ void unified_bed_leveling::shift_mesh_height() {
         }
       #endif
 
+      #if ENABLED(PROBE_PATH_PLANNER)
+        if (!do_furthest) {
+          // The next point on the planned path
+          best.invalidate();
+          if (path_index < ProbePath::count) {
+            const xy_uint8_t &p = ProbePath::points[path_index++];
+            best.pos.set(p.x, p.y);
+          }
+        }
+        else
+      #endif
       best = do_furthest
         ? find_furthest_invalid_mesh_point()
         : find_closest_mesh_point_of_type(INVALID, nearby, true);
@@ -801,6 +840,8 @@ void unified_bed_leveling::shift_mesh_height() {
 
     } while (best.pos.x >= 0 && --count);
 
+    TERN_(PROBE_PATH_PLANNER, if (!do_furthest) ProbePath::report(start_ms));
+
     TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::G29_FINISH));
 
     // Release UI during stow to allow for PAUSE_BEFORE_DEPLOY_STOW
@@ -402,6 +402,23 @@
       const float fade_scaling_factor = planner.fade_scaling_factor_for_z(destination.z);
     #endif
 
+    #if ENABLED(MESH_BICUBIC)
+
+      // The patches curve within a cell, so correct every segment end
+      for (;;) {
+        if (--segments == 0) raw = destination;     // if this is last segment, use destination for exact
+        else raw += diff;
+
+        const float oldz = raw.z;
+        raw.z += get_z_correction(raw) TERN_(ENABLE_LEVELING_FADE_HEIGHT, * fade_scaling_factor);
+        planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints);
+        raw.z = oldz;
+
+        if (segments == 0) return false;            // didn't set current from destination
+      }
+
+    #else
+
     // Move to first segment destination
     raw += diff;
 
@@ -484,6 +501,8 @@
       } // segment loop
     } // cell loop
 
+    #endif // !MESH_BICUBIC
+
     return false; // caller will update current_position
   }
 
@@ -33,4 +33,9 @@ bool SDFileTransferProtocol::transfer_active, SDFileTransferProtocol::dummy_tran
 
 BinaryStream binaryStream[NUM_SERIAL];
 
+#if BINARY_STREAM_WINDOW > 1
+  BinaryStream::HeldPacket BinaryStream::held[BINARY_STREAM_WINDOW - 1];
+  char BinaryStream::held_buffer[BINARY_STREAM_WINDOW - 1][MAX_CMD_SIZE];
+#endif
+
 #endif
@@ -31,6 +31,11 @@
   static heatshrink_decoder hsd;
 #endif
 
+// Number of packets the host may send before waiting for an 'ok'
+#ifndef BINARY_STREAM_WINDOW
+  #define BINARY_STREAM_WINDOW 1
+#endif
+
 inline bool bs_serial_data_available(const serial_index_t index) {
   return SERIAL_IMPL.available(index);
 }
@@ -250,10 +255,36 @@ public:
     }
   } packet{};
 
+  #if BINARY_STREAM_WINDOW > 1
+    // Packets received ahead of a lost or corrupt packet, held until the gap is filled
+    struct HeldPacket {
+      bool valid;
+      uint8_t sync, meta;
+      uint16_t size;
+    };
+    static HeldPacket held[BINARY_STREAM_WINDOW - 1];
+    static char held_buffer[BINARY_STREAM_WINDOW - 1][MAX_CMD_SIZE];
+    static int8_t held_find(const uint8_t id) {
+      LOOP_L_N(i, BINARY_STREAM_WINDOW - 1) if (held[i].valid && held[i].sync == id) return i;
+      return -1;
+    }
+    static int8_t held_free() {
+      LOOP_L_N(i, BINARY_STREAM_WINDOW - 1) if (!held[i].valid) return i;
+      return -1;
+    }
+    static void held_reset() { LOOP_L_N(i, BINARY_STREAM_WINDOW - 1) held[i].valid = false; }
+    int8_t held_slot;     // slot receiving the current packet, or -1 for the receive buffer
+    bool resend_requested;
+  #endif
+
   void reset() {
     sync = 0;
     packet_retries = 0;
     buffer_next_index = 0;
+    #if BINARY_STREAM_WINDOW > 1
+      held_reset();
+      resend_requested = false;
+    #endif
   }
 
   // fletchers 16 checksum
@@ -285,6 +316,10 @@ public:
       PORT_REDIRECT(SERIAL_PORTMASK(card.transfer_port_index));
     #endif
 
+    #if BINARY_STREAM_WINDOW > 1
+      static_assert(buffer_size <= MAX_CMD_SIZE, "BinaryStream held packet buffers are smaller than the receive buffer.");
+    #endif
+
     #pragma GCC diagnostic push
     #pragma GCC diagnostic ignored "-Warray-bounds"
 
@@ -322,21 +357,35 @@ public:
             if (packet.header.checksum == packet.header_checksum) {
               // The SYNC control packet is a special case in that it doesn't require the stream sync to be correct
               if (static_cast<Protocol>(packet.header.protocol()) == Protocol::CONTROL && static_cast<ProtocolControl>(packet.header.type()) == ProtocolControl::SYNC) {
+                  #if BINARY_STREAM_WINDOW > 1
+                    held_reset();
+                    resend_requested = false;
+                    SERIAL_ECHOLNPGM("sw", BINARY_STREAM_WINDOW); // window size, sent first so hosts that ignore it still sync
+                  #endif
                   SERIAL_ECHOLNPGM("ss", sync, ",", buffer_size, ",", VERSION_MAJOR, ".", VERSION_MINOR, ".", VERSION_PATCH);
                   stream_state = StreamState::PACKET_RESET;
                   break;
               }
-              if (packet.header.sync == sync) {
+              const uint8_t ahead = packet.header.sync - sync;     // packets ahead of the stream position
+              if (ahead < BINARY_STREAM_WINDOW) {
                 buffer_next_index = 0;
                 packet.bytes_received = 0;
-                if (packet.header.size) {
-                  stream_state = StreamState::PACKET_DATA;
-                  packet.buffer = static_cast<char *>(&buffer[0]); // multipacket buffering not implemented, always allocate whole buffer to packet
-                }
-                else
-                  stream_state = StreamState::PACKET_PROCESS;
+                packet.buffer = static_cast<char *>(&buffer[0]);   // the next packet in sequence gets the whole buffer
+                #if BINARY_STREAM_WINDOW > 1
+                  held_slot = -1;
+                  if (ahead) {
+                    if (held_find(packet.header.sync) >= 0) {      // already held, ok response must have been lost
+                      SERIAL_ECHOLNPGM("ok", packet.header.sync);
+                      stream_state = StreamState::PACKET_RESET;
+                      break;
+                    }
+                    held_slot = held_free();                       // always available, held packets are all within the window
+                    packet.buffer = held_buffer[held_slot];
+                  }
+                #endif
+                stream_state = packet.header.size ? StreamState::PACKET_DATA : StreamState::PACKET_PROCESS;
               }
-              else if (packet.header.sync == sync - 1) {           // ok response must have been lost
+              else if (uint8_t(sync - packet.header.sync) <= BINARY_STREAM_WINDOW) { // ok response must have been lost
                 SERIAL_ECHOLNPGM("ok", packet.header.sync);  // transmit valid packet received and drop the payload
                 stream_state = StreamState::PACKET_RESET;
               }
@@ -345,11 +394,13 @@ public:
               }
               else {
                 SERIAL_ECHO_MSG("Datastream packet out of order");
+                resend_id = sync;
                 stream_state = StreamState::PACKET_RESEND;
               }
             }
             else {
               SERIAL_ECHO_MSG("Packet header(", packet.header.sync, "?) corrupt");
+              resend_id = sync;
               stream_state = StreamState::PACKET_RESEND;
             }
           }
@@ -384,25 +435,52 @@ public:
             }
             else {
               SERIAL_ECHO_MSG("Packet(", packet.header.sync, ") payload corrupt");
+              resend_id = packet.header.sync;                      // the header is valid, so only this packet is resent
               stream_state = StreamState::PACKET_RESEND;
             }
           }
           break;
         case StreamState::PACKET_PROCESS:
-          sync++;
           packet_retries = 0;
           bytes_received += packet.header.size;
 
           SERIAL_ECHOLNPGM("ok", packet.header.sync); // transmit valid packet received
-          dispatch();
           stream_state = StreamState::PACKET_RESET;
+
+          #if BINARY_STREAM_WINDOW > 1
+            if (held_slot >= 0) {
+              // Hold the packet and ask for the missing one, once per gap
+              HeldPacket &h = held[held_slot];
+              h.sync = packet.header.sync;
+              h.meta = packet.header.meta;
+              h.size = packet.header.size;
+              h.valid = true;
+              if (!resend_requested) {
+                resend_requested = true;
+                SERIAL_ECHOLNPGM("rs", sync);
+              }
+              break;
+            }
+            resend_requested = false;
+          #endif
+
+          sync++;
+          dispatch(packet.header.meta, packet.buffer, packet.header.size);
+
+          #if BINARY_STREAM_WINDOW > 1
+            // Process the held packets that follow on from this one
+            for (int8_t i; (i = held_find(sync)) >= 0; sync++) {
+              held[i].valid = false;
+              dispatch(held[i].meta, held_buffer[i], held[i].size);
+            }
+          #endif
           break;
         case StreamState::PACKET_RESEND:
           if (packet_retries < MAX_RETRIES || MAX_RETRIES == 0) {
             packet_retries++;
             stream_state = StreamState::PACKET_RESET;
             SERIAL_ECHO_MSG("Resend request ", packet_retries);
-            SERIAL_ECHOLNPGM("rs", sync);
+            SERIAL_ECHOLNPGM("rs", resend_id);
           }
           else
             stream_state = StreamState::PACKET_ERROR;
@@ -422,10 +500,11 @@ public:
     #pragma GCC diagnostic pop
   }
 
-  void dispatch() {
-    switch (static_cast<Protocol>(packet.header.protocol())) {
+  void dispatch(const uint8_t meta, char *buffer, const uint16_t size) {
+    const uint8_t type = meta & 0xF;
+    switch (static_cast<Protocol>((meta >> 4) & 0xF)) {
       case Protocol::CONTROL:
-        switch (static_cast<ProtocolControl>(packet.header.type())) {
+        switch (static_cast<ProtocolControl>(type)) {
           case ProtocolControl::CLOSE: // revert back to ASCII mode
             card.flag.binary_mode = false;
             break;
@@ -434,7 +513,7 @@ public:
         }
         break;
       case Protocol::FILE_TRANSFER:
-        SDFileTransferProtocol::process(packet.header.type(), packet.buffer, packet.header.size); // send user data to be processed
+        SDFileTransferProtocol::process(type, buffer, size); // send user data to be processed
       break;
       default:
         SERIAL_ECHO_MSG("Unsupported Binary Protocol");
@@ -447,7 +526,7 @@ public:
   }
 
   static const uint16_t PACKET_MAX_WAIT = 500, RX_TIMESLICE = 20, MAX_RETRIES = 0, VERSION_MAJOR = 0, VERSION_MINOR = 1, VERSION_PATCH = 0;
-  uint8_t  packet_retries, sync;
+  uint8_t  packet_retries, sync, resend_id;
   uint16_t buffer_next_index;
   uint32_t bytes_received;
   StreamState stream_state = StreamState::PACKET_RESET;
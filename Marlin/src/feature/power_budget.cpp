@@ -0,0 +1,181 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2023 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Heater Power Budget
+ *
+ * Each heater's soft PWM amount is an on-time of 0-127 counts per PWM cycle. The budget
+ * places each on-time at its own phase of the cycle, so the watts of the heaters that are
+ * on at any count never add up to more than HEATER_POWER_BUDGET. Heaters are placed one
+ * after another around the cycle, and each one is cut short where it would overflow.
+ *
+ * Heaters within a few degrees of their target go first, since they need little power and
+ * shouldn't droop. The rest go in order of the heat they still need, which is the estimated
+ * time to reach the target at full power times the heater's watts. A big heater that is far
+ * from its target can't share the budget with many others, so it goes before the small ones,
+ * which take turns in what's left as their own needs change places from one update to the next.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if HAS_POWER_BUDGET
+
+#include "power_budget.h"
+#include "../module/temperature.h"
+#include "../core/serial.h"
+
+PowerBudget power_budget;
+
+uint8_t PowerBudget::phase[POWER_BUDGET_HEATERS],
+        PowerBudget::request[POWER_BUDGET_HEATERS],
+        PowerBudget::grant[POWER_BUDGET_HEATERS];
+uint16_t PowerBudget::granted_watts, PowerBudget::requested_watts;
+float PowerBudget::full_rate[POWER_BUDGET_HEATERS];
+celsius_float_t PowerBudget::last_temp[POWER_BUDGET_HEATERS];
+millis_t PowerBudget::last_ms;
+
+#define PB_HOLD_BAND 2 // (°C) Heaters this close to their target are holding temperature
+
+#if HAS_HOTEND
+  constexpr float hotend_watts[] = HOTEND_HEATER_WATTS;
+#endif
+
+#define _HOTEND_WATTS(N) uint16_t(hotend_watts[N]),
+static constexpr uint16_t heater_watts[] = {
+  REPEAT(HOTENDS, _HOTEND_WATTS)
+  OPTITEM(HAS_HEATED_BED, BED_HEATER_WATTS)
+  OPTITEM(HAS_HEATED_CHAMBER, CHAMBER_HEATER_WATTS)
+};
+#undef _HOTEND_WATTS
+
+#define _HOTEND_INFO(N) &thermalManager.temp_hotend[N],
+static const heater_info_t * const heaters[] = {
+  REPEAT(HOTENDS, _HOTEND_INFO)
+  OPTITEM(HAS_HEATED_BED, &thermalManager.temp_bed)
+  OPTITEM(HAS_HEATED_CHAMBER, &thermalManager.temp_chamber)
+};
+#undef _HOTEND_INFO
+
+// A heater that gets no power can't warm up, so restart its "heating failed" watch
+static void restart_watch(const uint8_t i) {
+  #if HAS_HOTEND
+    if (i < HOTENDS) return thermalManager.start_watching_hotend(i);
+  #endif
+  #if HAS_HEATED_BED
+    if (i == POWER_BUDGET_BED) return thermalManager.start_watching_bed();
+  #endif
+  #if HAS_HEATED_CHAMBER
+    if (i == POWER_BUDGET_CHAMBER) return thermalManager.start_watching_chamber();
+  #endif
+}
+
+// Watts drawn at a soft PWM count by the heaters placed so far
+static uint16_t load_at(const uint8_t count, const uint8_t order[], const uint8_t placed, const uint8_t start[], const uint8_t len[]) {
+  uint16_t watts = 0;
+  for (uint8_t o = 0; o < placed; ++o) {
+    const uint8_t i = order[o];
+    if (PowerBudget::on_at(count, start[i], len[i])) watts += heater_watts[i];
+  }
+  return watts;
+}
+
+void PowerBudget::apply(const millis_t &ms) {
+  const float dt = (ms - last_ms) * 0.001f;
+  last_ms = ms;
+
+  uint8_t order[POWER_BUDGET_HEATERS];
+  float need[POWER_BUDGET_HEATERS];
+  uint32_t requested = 0;
+
+  for (uint8_t i = 0; i < POWER_BUDGET_HEATERS; ++i) {
+    const heater_info_t &h = *heaters[i];
+
+    // The controller's output is the request. The grant goes to the ISR and leaves it alone.
+    request[i] = h.soft_pwm_amount;
+    requested += uint32_t(heater_watts[i]) * request[i];
+
+    // Learn how fast the heater warms at full power while it has some power
+    if (grant[i] >= 16 && dt > 0) {
+      const float rate = (h.celsius - last_temp[i]) / dt * 127 / grant[i];
+      if (rate > 0) full_rate[i] = full_rate[i] ? full_rate[i] + (rate - full_rate[i]) * 0.125f : rate;
+    }
+    last_temp[i] = h.celsius;
+
+    // Holding heaters first, then the most heat (W·s) still needed. A heater that hasn't
+    // had power yet has no rate, so it comes next to get some and learn its rate.
+    const float below = h.target - h.celsius;
+    need[i] = below <= PB_HOLD_BAND ? 1e30f : full_rate[i] ? below / full_rate[i] * heater_watts[i] : 1e20f;
+
+    // Insertion sort, stable for equal needs
+    uint8_t o = i;
+    for (; o && need[order[o - 1]] < need[i]; --o) order[o] = order[o - 1];
+    order[o] = i;
+  }
+
+  // Place each heater's on-time after the previous one, cut short where the budget overflows
+  uint8_t new_phase[POWER_BUDGET_HEATERS], new_grant[POWER_BUDGET_HEATERS], cursor = 0;
+  uint32_t granted = 0;
+  for (uint8_t o = 0; o < POWER_BUDGET_HEATERS; ++o) {
+    const uint8_t i = order[o], want = request[i];
+    const uint16_t watts = heater_watts[i];
+    uint8_t start = cursor, len = 0;
+    if (want) {
+      // Find the first count from the cursor with room for this heater
+      uint8_t tries = 0;
+      while (tries < 127 && load_at(start, order, o, new_phase, new_grant) + watts > (HEATER_POWER_BUDGET)) {
+        if (++start >= 127) start = 0;
+        ++tries;
+      }
+      // Extend the on-time while it fits
+      if (tries < 127) {
+        const uint8_t most = _MIN(want, 127);
+        for (uint8_t c = start; len < most && load_at(c, order, o, new_phase, new_grant) + watts <= (HEATER_POWER_BUDGET); ++len)
+          if (++c >= 127) c = 0;
+        cursor = (start + len) % 127;
+      }
+      else
+        restart_watch(i);
+    }
+    new_phase[i] = start;
+    new_grant[i] = len;
+    granted += uint32_t(watts) * len;
+  }
+
+  // The ISR must see a consistent set of phases and amounts
+  DISABLE_TEMPERATURE_INTERRUPT();
+  for (uint8_t i = 0; i < POWER_BUDGET_HEATERS; ++i) {
+    phase[i] = new_phase[i];
+    grant[i] = new_grant[i];
+  }
+  ENABLE_TEMPERATURE_INTERRUPT();
+
+  requested_watts = requested / 127;
+  granted_watts = granted / 127;
+}
+
+void PowerBudget::report() {
+  SERIAL_ECHOPGM(" PWR:", granted_watts);
+  SERIAL_CHAR('/');
+  SERIAL_ECHO(requested_watts);
+}
+
+#endif // HAS_POWER_BUDGET
@@ -0,0 +1,69 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2023 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/power_budget.h - Share heater PWM out under a total power limit
+ */
+
+#include "../inc/MarlinConfig.h"
+
+// Hotends, then the bed, then the chamber
+#define POWER_BUDGET_HEATERS (HOTENDS + COUNT_ENABLED(HAS_HEATED_BED, HAS_HEATED_CHAMBER))
+#define POWER_BUDGET_BED     (HOTENDS)
+#define POWER_BUDGET_CHAMBER (HOTENDS + ENABLED(HAS_HEATED_BED))
+
+class PowerBudget {
+public:
+  static uint8_t phase[POWER_BUDGET_HEATERS];     // Soft PWM count where each heater's on-time starts
+  static uint16_t granted_watts, requested_watts; // Average heater power after and before the last apply()
+
+  // Grant the PWM amounts just set by Temperature::task(), cut down to fit the budget
+  static void apply(const millis_t &ms);
+
+  // Append " PWR:granted/requested" to a temperature report
+  static void report();
+
+  // Is an on-time of 'amount' counts starting at 'start' on at soft PWM count 'count' (0-126)?
+  static bool on_at(const uint8_t count, const uint8_t start, const uint8_t amount) {
+    return uint8_t(count >= start ? count - start : count + 127 - start) < amount;
+  }
+
+  // The PWM amount a heater gets: its grant, or less if its controller has since lowered
+  // its output (e.g., to turn it off) and the budget hasn't caught up
+  static uint8_t granted(const uint8_t i, const uint8_t amount) { return _MIN(grant[i], amount); }
+
+  // Did the heater get less than it asked for? Its controller shouldn't wind up meanwhile.
+  static bool starved(const uint8_t i) { return grant[i] < request[i]; }
+
+  // Called from the Temperature ISR for each heater, with the amount its controller set
+  static bool is_on(const uint8_t i, const uint8_t count, const uint8_t amount) { return on_at(count, phase[i], granted(i, amount)); }
+
+private:
+  static uint8_t request[POWER_BUDGET_HEATERS],   // PWM amount each heater asked for
+                 grant[POWER_BUDGET_HEATERS];     // PWM amount each heater was given, read by the ISR
+  static float full_rate[POWER_BUDGET_HEATERS];   // (°C/s) Learned heating rate at full power
+  static celsius_float_t last_temp[POWER_BUDGET_HEATERS];
+  static millis_t last_ms;
+};
+
+extern PowerBudget power_budget;
@@ -0,0 +1,290 @@
+/**
+ * Marlin 3D Printer Firmware
+ *
+ * Copyright (c) 2023 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ * Copyright (c) 2016 Bob Cousins bobcousins42@googlemail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * feature/segment_merge.cpp - Merge short G1 moves into lines or arcs ahead of the planner
+ *
+ * When a G1 is processed, look ahead in the command queue for more G1 moves with
+ * the same feedrate and extrusion ratio that continue along (nearly) the same line
+ * (SEGMENT_MERGING) or circle (ARC_FITTING). Absorb them, acknowledging each one,
+ * and plan a single line or arc from the start of the first to the end of the last.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if HAS_SEGMENT_MERGE
+
+#include "segment_merge.h"
+
+#include "../gcode/gcode.h"
+#include "../gcode/queue.h"
+#include "../module/motion.h"
+
+#if ENABLED(CANCEL_OBJECTS)
+  #include "cancel_object.h"
+#endif
+
+#if ENABLED(POWER_LOSS_RECOVERY)
+  #include "powerloss.h"
+#endif
+
+#if HAS_MEDIA
+  #include "../sd/cardreader.h"
+#endif
+
+#if BOTH(PRINTCOUNTER, HAS_EXTRUDERS)
+  #include "../module/printcounter.h"
+#endif
+
+#if ENABLED(ARC_FITTING)
+  #ifndef ARC_FIT_MAX_RADIUS
+    #define ARC_FIT_MAX_RADIUS 1000 // (mm) Flatter curves are left as lines
+  #endif
+  void plan_arc(const xyze_pos_t&, const ab_float_t&, const bool, const uint8_t);
+#endif
+
+SegmentMerge segment_merge;
+
+uint32_t SegmentMerge::segments_in, SegmentMerge::moves_out;
+#if ENABLED(ARC_FITTING)
+  uint32_t SegmentMerge::arcs_out;
+#endif
+
+// Parameters that prevent a G1 from being merged
+#define MERGE_EXCLUDE_PARAMS "ABCDGHIJKLMOPQRSTUVW"
+
+// The most G1 moves that can be merged into one
+static constexpr uint8_t merge_max = _MAX(TERN0(SEGMENT_MERGING, SEGMENT_MERGE_MAX), TERN0(ARC_FITTING, ARC_FIT_MAX));
+
+static float dot_xyz(const xyz_pos_t &a, const xyz_pos_t &b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+/**
+ * Get the destination of the parsed G1, continuing from 'from'.
+ * Return false if the command moves anything other than X, Y, Z, and E.
+ */
+static bool get_merge_destination(xyze_pos_t &dest, const xyze_pos_t &from) {
+  dest = from;
+  LOOP_NUM_AXES(i) {
+    if (parser.seenval(AXIS_CHAR(i))) {
+      if (i > Z_AXIS) return false;
+      const float v = parser.value_axis_units((AxisEnum)i);
+      dest[i] = GcodeSuite::axis_is_relative(AxisEnum(i)) ? from[i] + v : LOGICAL_TO_NATIVE(v, i);
+    }
+  }
+  #if HAS_EXTRUDERS
+    if (parser.seenval('E')) {
+      const float v = parser.value_axis_units(E_AXIS);
+      dest.e = GcodeSuite::axis_is_relative(E_AXIS) ? from.e + v : v;
+    }
+  #endif
+  return true;
+}
+
+#if ENABLED(SEGMENT_MERGING)
+
+  // Check that every point between the first and the last is within tolerance of the line joining them
+  static bool fits_line(const xyze_pos_t point[], const uint8_t last) {
+    const xyz_pos_t start = point[0], chord = xyz_pos_t(point[last]) - start;
+    const float inv_chord_sq = 1.0f / dot_xyz(chord, chord);
+    for (uint8_t i = 1; i < last; ++i) {
+      const xyz_pos_t d = xyz_pos_t(point[i]) - start;
+      if (dot_xyz(d, d) - sq(dot_xyz(d, chord)) * inv_chord_sq > sq(float(SEGMENT_MERGE_TOLERANCE))) return false;
+    }
+    return true;
+  }
+
+#endif
+
+#if ENABLED(ARC_FITTING)
+
+  /**
+   * Fit a circle through the first, middle, and last points. Check that the other points
+   * are on it and that every chord (the original moves) is within tolerance of the arc.
+   * Get the center of the arc and its direction.
+   */
+  static bool fits_arc(const xyze_pos_t point[], const uint8_t last, xy_pos_t &center, bool &clockwise) {
+    const xy_pos_t start = point[0],
+                   b = xy_pos_t(point[last / 2]) - start,
+                   c = xy_pos_t(point[last]) - start;
+    const float cross = b.x * c.y - b.y * c.x;
+    if (NEAR_ZERO(cross)) return false;                 // Points in a line
+
+    // Circumcenter relative to the start point
+    const float b2 = b.x * b.x + b.y * b.y, c2 = c.x * c.x + c.y * c.y, d = 0.5f / cross;
+    const xy_pos_t offset = { (c.y * b2 - b.y * c2) * d, (b.x * c2 - c.x * b2) * d };
+    const float radius = offset.magnitude();
+    if (radius > (ARC_FIT_MAX_RADIUS)) return false;    // Flat enough to be a line
+
+    center = start + offset;
+    clockwise = cross < 0;
+
+    float total_angle = 0;
+    xy_pos_t r0 = -offset;
+    for (uint8_t i = 1; i <= last; ++i) {
+      const xy_pos_t r1 = xy_pos_t(point[i]) - center;
+      if (i < last && ABS(r1.magnitude() - radius) > (ARC_FIT_TOLERANCE)) return false;
+
+      // Each chord goes the same way around, no further from the arc than the tolerance
+      if ((r0.x * r1.y - r0.y * r1.x < 0) != clockwise) return false;
+      const float half_chord = (r1 - r0).magnitude() * 0.5f;
+      if (half_chord >= radius || radius - SQRT(sq(radius) - sq(half_chord)) > (ARC_FIT_TOLERANCE)) return false;
+
+      total_angle += 2 * asinf(half_chord / radius);
+      r0 = r1;
+    }
+
+    // Less than a full circle
+    return total_angle < RADIANS(359);
+  }
+
+#endif // ARC_FITTING
+
+/**
+ * Called by G0_G1 with the parsed move in 'destination', before it is prepared.
+ * Extend 'destination' with any mergeable G1 moves that follow in the command queue.
+ * Return 'true' if the result was planned here as an arc.
+ */
+bool SegmentMerge::merge_queued_moves() {
+  segments_in++;
+  moves_out++;
+
+  // Only merge commands that are running from the command queue, in order
+  GCodeQueue::RingBuffer &ring = queue.ring_buffer;
+  if (ring.length < 2 || !WITHIN(parser.command_ptr, ring.peek_next_command_string(), ring.peek_next_command_string() + MAX_CMD_SIZE - 1)) return false;
+  if (TERN0(CANCEL_OBJECTS, cancelable.skipping) || TERN0(HAS_MEDIA, card.flag.saving || card.flag.logging)) return false;
+
+  // Moves in other axes aren't merged
+  LOOP_S_L_N(i, Z_AXIS + 1, NUM_AXES) if (destination[i] != current_position[i]) return false;
+
+  // Neither are E-only moves
+  xyze_pos_t point[merge_max + 1] = { current_position, destination };
+  const float first_length = (xyz_pos_t(point[1]) - xyz_pos_t(point[0])).magnitude();
+  if (first_length < 0.001f) return false;
+
+  // The extrusion ratio (E per mm) of the first move and the allowed deviation from it
+  const float e_ratio = TERN0(HAS_EXTRUDERS, (point[1].e - point[0].e) / first_length),
+              e_ratio_tolerance = ABS(e_ratio) * (SEGMENT_MERGE_E_RATIO) * 0.01f;
+
+  // Gather the following moves for as long as they still fit a line or an arc
+  uint8_t last = 1,       // The last point gathered
+          line_end = 1,   // The last point of the longest line...
+          arc_end = 1,    // ...and the longest arc
+          peeked = 0;     // Commands parsed ahead of the current one
+  bool line_ok = ENABLED(SEGMENT_MERGING);
+
+  #if ENABLED(ARC_FITTING)
+    bool arc_ok = point[1].z == point[0].z && TERN1(CNC_WORKSPACE_PLANES, gcode.workspace_plane == GcodeSuite::PLANE_XY),
+         arc_clockwise = false;
+    xy_pos_t arc_center{0};
+  #else
+    constexpr bool arc_ok = false;
+  #endif
+
+  while ((line_ok || arc_ok) && last < merge_max && last < ring.length) {
+
+    // Injected commands must run before the rest of the queue
+    if (queue.injected_commands_P || queue.injected_commands[0]) break;
+
+    GCodeQueue::CommandLine &next = ring.commands[(ring.index_r + last) % (BUFSIZE)];
+    if (TERN0(HAS_MULTI_SERIAL, next.port != ring.command_port())) break;
+
+    parser.parse(next.buffer);
+    peeked++;
+
+    // Merge only plain G1 moves with the same feedrate
+    if (!parser.is_command('G', 1) || TERN0(USE_GCODE_SUBCODES, parser.subcode) || parser.seen(MERGE_EXCLUDE_PARAMS)) break;
+    if (parser.floatval('F') > 0 && parser.value_feedrate() != feedrate_mm_s) break;
+
+    xyze_pos_t &target = point[last + 1];
+    if (!get_merge_destination(target, point[last])) break;
+
+    // The move must continue forward, less than 90° from the last one
+    const xyz_pos_t move = xyz_pos_t(target) - xyz_pos_t(point[last]);
+    const float length = move.magnitude();
+    if (length < 0.001f || dot_xyz(move, xyz_pos_t(point[last]) - xyz_pos_t(point[last - 1])) <= 0) break;
+
+    // Its extrusion ratio must match the first move
+    #if HAS_EXTRUDERS
+      if (ABS((target.e - point[last].e) / length - e_ratio) > e_ratio_tolerance) break;
+    #endif
+
+    last++;
+
+    #if ENABLED(SEGMENT_MERGING)
+      if (line_ok) {
+        if (last <= SEGMENT_MERGE_MAX && fits_line(point, last)) line_end = last;
+        else line_ok = false;
+      }
+    #endif
+
+    #if ENABLED(ARC_FITTING)
+      // Arcs need at least three moves. A bad fit ends the arc, since it can only get worse.
+      if (arc_ok) {
+        if (last > ARC_FIT_MAX || target.z != point[0].z)
+          arc_ok = false;
+        else if (last >= 3) {
+          xy_pos_t center;
+          bool clockwise;
+          if (fits_arc(point, last, center, clockwise)) {
+            arc_end = last;
+            arc_center = center;
+            arc_clockwise = clockwise;
+          }
+          else
+            arc_ok = false;
+        }
+      }
+    #endif
+  }
+
+  const bool is_arc = arc_end > line_end;
+  const uint8_t end = is_arc ? arc_end : line_end;
+
+  // The current command is done, so acknowledge it and make the next merged one current
+  for (uint8_t i = 2; i <= end; ++i) {
+    #if BOTH(PRINTCOUNTER, HAS_EXTRUDERS)
+      if (!DEBUGGING(DRYRUN)) print_job_timer.incFilamentUsed(point[i].e - point[i - 1].e);
+    #endif
+    queue.ok_to_send();
+    ring.advance_pos(ring.index_r, -1);
+    TERN_(POWER_LOSS_RECOVERY, recovery.queue_index_r = ring.index_r);
+    if (DEBUGGING(ECHO)) { SERIAL_ECHO_START(); SERIAL_ECHOLN(ring.peek_next_command_string()); }
+  }
+  segments_in += end - 1;
+
+  // Restore the parser state for the current command
+  if (peeked > end - 1) parser.parse(ring.peek_next_command_string());
+
+  destination = point[end];
+
+  #if ENABLED(ARC_FITTING)
+    if (is_arc) {
+      arcs_out++;
+      plan_arc(destination, arc_center - xy_pos_t(current_position), arc_clockwise, 0);
+      gcode.reset_stepper_timeout();
+      return true;
+    }
+  #endif
+
+  return false;
+}
+
+#endif // HAS_SEGMENT_MERGE
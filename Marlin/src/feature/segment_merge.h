@@ -0,0 +1,45 @@
+/**
+ * Marlin 3D Printer Firmware
+ *
+ * Copyright (c) 2023 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ * Copyright (c) 2016 Bob Cousins bobcousins42@googlemail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/segment_merge.h - Merge short G1 moves into lines or arcs ahead of the planner
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#include <stdint.h>
+
+class SegmentMerge {
+public:
+  static uint32_t segments_in,  // G1 moves seen by the merge stage
+                  moves_out;    // Lines and arcs passed on to the planner
+  #if ENABLED(ARC_FITTING)
+    static uint32_t arcs_out;   // Arcs passed on to the planner
+  #endif
+
+  static void reset_stats() { segments_in = moves_out = 0; TERN_(ARC_FITTING, arcs_out = 0); }
+
+  // Extend 'destination' with queued G1 moves. Return 'true' if an arc was planned.
+  static bool merge_queued_moves();
+};
+
+extern SegmentMerge segment_merge;
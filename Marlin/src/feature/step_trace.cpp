@@ -0,0 +1,144 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2023 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(STEP_TRACE)
+
+#include "step_trace.h"
+#include "../module/planner.h"
+
+// Events sent to the serial port per idle() call
+#define STEP_TRACE_LINES_PER_IDLE 8
+
+StepTrace step_trace;
+
+step_trace_event_t StepTrace::ring[STEP_TRACE_SIZE];
+volatile StepTrace::index_t StepTrace::head, StepTrace::tail;
+bool StepTrace::capture, StepTrace::serial_out;
+volatile bool StepTrace::recording;
+uint32_t StepTrace::recorded, StepTrace::dropped, StepTrace::gap_drops, StepTrace::isr_ticks, StepTrace::now;
+
+void StepTrace::start(const bool stop_when_full) {
+  recording = false;
+  tail = head;
+  recorded = dropped = gap_drops = 0;
+  capture = stop_when_full;
+  recording = true;
+}
+
+/**
+ * The header of a trace gives what a host needs to read the events:
+ * "# step trace rate=<ticks/s> axes=<names> steps_per_mm=<per axis>"
+ * Events follow as "tick,block,steps,dirs" with the axis masks in decimal, and
+ * "# dropped <count>" where events didn't fit in the ring.
+ */
+void StepTrace::report_header() {
+  SERIAL_ECHOPGM("# step trace rate=", STEPPER_TIMER_RATE, " axes=");
+  LOOP_L_N(a, LOGICAL_AXES) {
+    if (a) SERIAL_CHAR(',');
+    SERIAL_CHAR(TERN_(HAS_EXTRUDERS, a == E_AXIS ? 'E' :) AXIS_CHAR(a));
+  }
+  SERIAL_ECHOPGM(" steps_per_mm=");
+  LOOP_L_N(a, LOGICAL_AXES) {
+    if (a) SERIAL_CHAR(',');
+    SERIAL_ECHO_F(planner.settings.axis_steps_per_mm[a], 4);
+  }
+  SERIAL_EOL();
+}
+
+void StepTrace::report_status() {
+  SERIAL_ECHOLNPGM("# step trace ", recording ? F("recording") : F("stopped"), " recorded=", recorded, " dropped=", dropped);
+}
+
+/**
+ * Send waiting events to the serial port a few at a time. Mark where events were
+ * dropped, so the host can start over from there, and report the end of a trace.
+ */
+void StepTrace::idle() {
+  if (!serial_out) return;
+
+  step_trace_event_t ev;
+  for (uint8_t n = STEP_TRACE_LINES_PER_IDLE; n && pop(ev); --n) {
+    if (ev.steps)
+      SERIAL_ECHOLNPGM("", ev.tick, ",", ev.block, ",", ev.steps, ",", ev.dirs);
+    else
+      SERIAL_ECHOLNPGM("# dropped ", ev.tick);
+  }
+
+  if (!recording && !available()) {
+    const uint32_t end_drops = take_end_drops();
+    if (end_drops) SERIAL_ECHOLNPGM("# dropped ", end_drops);
+    report_status();
+    serial_out = false;
+  }
+}
+
+#if ENABLED(MARLIN_TEST_BUILD)
+
+  #include "../tests/marlin_tests.h"
+
+  /**
+   * Overfill the ring while streaming, then make room. The events that fit must come out
+   * in order, followed by one gap marker with the drop count and the events after it.
+   * A capture must stop at the first event that doesn't fit.
+   */
+  void StepTrace::test() {
+    constexpr uint16_t fits = (STEP_TRACE_SIZE) - 1, extra = 5, room = 10;
+    uint16_t failures = 0;
+    step_trace_event_t ev;
+
+    auto record_ticks = [](const uint32_t from, const uint16_t count) {
+      for (uint16_t i = 0; i < count; ++i) { now = from + i; record(1, 1, 0); }
+    };
+
+    start(false);
+    record_ticks(0, fits + extra);
+    if (recorded != fits || dropped != extra || !recording) ++failures;
+    for (uint16_t i = 0; i < room; ++i) if (!pop(ev) || ev.tick != i) ++failures;
+    record_ticks(1000000, 3);
+
+    uint32_t expect = room;
+    bool seen_gap = false;
+    while (pop(ev)) {
+      if (!ev.steps) {
+        if (seen_gap || expect != fits || ev.tick != extra) ++failures;
+        seen_gap = true;
+        expect = 1000000;
+      }
+      else if (ev.tick != expect++) ++failures;
+    }
+    if (!seen_gap || expect != 1000003) ++failures;
+
+    start(true);
+    record_ticks(0, fits + extra);
+    if (recorded != fits || dropped != 1 || recording) ++failures;
+    while (pop(ev)) {}
+
+    stop();
+    countTestFailures(failures);
+    SERIAL_ECHOLNPGM("Step trace: ", failures, " mismatches");
+  }
+
+#endif // MARLIN_TEST_BUILD
+
+#endif // STEP_TRACE
@@ -0,0 +1,126 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2023 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * feature/step_trace.h - Timestamped record of the step pulses sent by the stepper ISR
+ *
+ * Each call of the stepper ISR that sends pulses records the stepper timer tick it was
+ * scheduled for, the axes stepped, the axis directions and the planner block index.
+ * Steps sent together by multi-stepping share a tick. The stepper ISR is the only
+ * producer and the main loop the only consumer, so the ring needs no locking.
+ *
+ * Ticks are counted in the schedule of the stepper ISR at STEPPER_TIMER_RATE and wrap
+ * after 2^32. With FT_MOTION the block index is the block being turned into stepper
+ * commands, which runs ahead of the steps by the stepper command buffer.
+ *
+ * buildroot/share/scripts/step_trace.py reads the trace and reports the velocity,
+ * acceleration and jerk of each axis.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+typedef AxisBits::el step_trace_bits_t;
+
+typedef struct {
+  uint32_t tick;            // Stepper timer tick of the pulses, or the count of events dropped
+  uint8_t block;            // Planner block buffer index
+  step_trace_bits_t steps,  // Axes stepped, by AxisEnum
+                    dirs;   // Axis directions, set for forward
+} step_trace_event_t;
+
+class StepTrace {
+public:
+  typedef uvalue_t(STEP_TRACE_SIZE - 1) index_t;
+
+  static step_trace_event_t ring[STEP_TRACE_SIZE];
+  static volatile index_t head, tail;
+
+  // Stop at the first event that doesn't fit, for a trace with no gaps
+  static bool capture;
+  static volatile bool recording;
+  static uint32_t recorded, dropped;
+
+  // The stepper ISR keeps the tick of its current pass
+  static uint32_t isr_ticks, now;
+
+  // Begin recording into an empty ring
+  static void start(const bool stop_when_full);
+  static void stop() { recording = false; }
+
+  // Called by the stepper ISR for each pass, with the axes it steps
+  FORCE_INLINE static void record(const step_trace_bits_t steps, const step_trace_bits_t dirs, const uint8_t block) {
+    if (!recording || !steps) return;
+    const index_t room = (tail - head - 1) & ((STEP_TRACE_SIZE) - 1);
+    if (room > (gap_drops ? 1 : 0)) {
+      // After dropped events mark the gap, as an event with no steps, ahead of the next one
+      if (gap_drops) { push({ gap_drops, block, 0, 0 }); gap_drops = 0; }
+      push({ now, block, steps, dirs });
+      recorded++;
+    }
+    else {
+      dropped++;
+      gap_drops++;
+      if (capture) recording = false;
+    }
+  }
+
+  FORCE_INLINE static void record(const AxisFlags &steps, const AxisBits &dirs, const uint8_t block) {
+    record(step_trace_bits_t(bits_t(LOGICAL_AXES)(steps.flags.b)), dirs.bits, block);
+  }
+
+  static bool available() { return head != tail; }
+
+  // Take the oldest event. Return false if the ring is empty.
+  // An event with no steps marks a gap, with the count of events dropped as its tick.
+  static bool pop(step_trace_event_t &ev) {
+    const index_t t = tail;
+    if (t == head) return false;
+    ev = ring[t];
+    tail = (t + 1) & ((STEP_TRACE_SIZE) - 1);
+    return true;
+  }
+
+  // Take the count of events dropped after the last gap marker, to mark the end of a trace
+  static uint32_t take_end_drops() { const uint32_t n = gap_drops; gap_drops = 0; return n; }
+
+  // Send events and the start and end of a trace to the serial port
+  static bool serial_out;
+  static void report_header();
+  static void report_status();
+  static void idle();
+
+  #if ENABLED(MARLIN_TEST_BUILD)
+    static void test();
+  #endif
+
+private:
+  static uint32_t gap_drops;  // Events dropped since the last gap was marked
+
+  FORCE_INLINE static void push(const step_trace_event_t &ev) {
+    const index_t h = head;
+    ring[h] = ev;
+    head = (h + 1) & ((STEP_TRACE_SIZE) - 1);
+  }
+};
+
+extern StepTrace step_trace;
@@ -120,6 +120,10 @@
   #include "../../feature/bedlevel/hilbert_curve.h"
 #endif
 
+#if ENABLED(PROBE_PATH_PLANNER)
+  #include "../../feature/bedlevel/probe_path.h"
+#endif
+
 #define EXTRUSION_MULTIPLIER 1.0
 #define PRIME_LENGTH 10.0
 #define OOZE_AMOUNT 0.3
@@ -419,6 +423,18 @@ typedef struct {
     mesh_index_pair out_point;
     out_point.pos = -1;
 
+    #if ENABLED(PROBE_PATH_PLANNER)
+      if (path_index >= 0) {
+        // The next circle on the planned path
+        if (path_index < ProbePath::count) {
+          const xy_uint8_t &p = ProbePath::points[path_index++];
+          out_point.pos.set(p.x, p.y);
+          circle_flags.mark(out_point);
+        }
+        return out_point;
+      }
+    #endif
+
     #if ENABLED(UBL_HILBERT_CURVE)
 
       auto test_func = [](uint8_t i, uint8_t j, void *data) -> bool {
@@ -467,6 +483,38 @@ typedef struct {
     return out_point;
   }
 
+  #if ENABLED(PROBE_PATH_PLANNER)
+
+    int16_t path_index = -1;  // The next circle on the planned path, or -1 before planning
+    millis_t path_start_ms;
+
+    /**
+     * Take the reachable circles in the order they would be printed, then plan the path
+     * through them from the current position. The first circle stays first: the one nearest
+     * the G26 X Y start, or nearest the nozzle with K.
+     */
+    void plan_path() {
+      path_start_ms = millis();
+      ProbePath::reset();
+      xy_pos_t from = continue_with_closest ? xy_pos_t(current_position) : xy_pos;
+      for (;;) {
+        const mesh_index_pair p = find_closest_circle_to_print(from);
+        if (!p.valid()) break;
+        const xy_pos_t circle = { bedlevel.get_mesh_x(p.pos.x), bedlevel.get_mesh_y(p.pos.y) };
+        if (!position_is_reachable(circle)) continue;
+        ProbePath::add(p.pos.x, p.pos.y);
+        if (continue_with_closest) from = circle;
+      }
+      circle_flags.reset();
+
+      const xy_pos_t origin = { bedlevel.get_mesh_x(0), bedlevel.get_mesh_y(0) };
+      ProbePath::set_grid(origin, { bedlevel.get_mesh_x(1) - origin.x, bedlevel.get_mesh_y(1) - origin.y }, G26_XY_FEEDRATE_TRAVEL);
+      ProbePath::plan(current_position, 1);
+      path_index = 0;
+    }
+
+  #endif
+
 } g26_helper_t;
 
 /**
@@ -684,6 +732,8 @@ void GcodeSuite::G26() {
 
   circle_flags.reset();
 
+  TERN_(PROBE_PATH_PLANNER, g26.plan_path());
+
   // Move nozzle to the specified height for the first layer
   destination = current_position;
   destination.z = g26.layer_height;
@@ -846,6 +896,7 @@ void GcodeSuite::G26() {
 
   LEAVE:
   LCD_MESSAGE_MIN(MSG_G26_LEAVING);
+  TERN_(PROBE_PATH_PLANNER, if (g26.path_index >= 0) ProbePath::report(g26.path_start_ms));
   TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(location, ExtUI::G26_FINISH));
 
   g26.retract_filament(destination);
@@ -43,6 +43,14 @@
   #include "../../../libs/vector_3.h"
 #endif
 
+#if ENABLED(G29_ADAPTIVE_PROBING)
+  #include "../../../feature/bedlevel/abl/adaptive_probe.h"
+#endif
+
+#if ENABLED(PROBE_PATH_PLANNER)
+  #include "../../../feature/bedlevel/probe_path.h"
+#endif
+
 #include "../../../lcd/marlinui.h"
 #if ENABLED(EXTENSIBLE_UI)
   #include "../../../lcd/extui/ui_api.h"
@@ -130,6 +138,10 @@ public:
       bed_mesh_t z_values;
     #endif
 
+    #if ENABLED(G29_ADAPTIVE_PROBING)
+      float adaptive_tolerance;
+    #endif
+
     #if ENABLED(AUTO_BED_LEVELING_LINEAR)
       int indexIntoAB[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
       float eqnAMatrix[GRID_MAX_POINTS * 3],  // "A" matrix of the linear system of equations
@@ -144,6 +156,39 @@ public:
   constexpr grid_count_t G29_State::abl_points;
 #endif
 
+#if ENABLED(G29_ADAPTIVE_PROBING)
+
+  typedef struct {
+    G29_State &abl;
+    ProbePtRaise raise_after;
+    bool faux;
+  } adaptive_g29_t;
+
+  // Probe one mesh point for AdaptiveProbe
+  static float adaptive_probe_point(const uint8_t x, const uint8_t y, void *data) {
+    adaptive_g29_t &d = *(adaptive_g29_t*)data;
+    G29_State &abl = d.abl;
+
+    abl.meshCount.set(x, y);
+    abl.probePos = abl.probe_position_lf + abl.gridSpacing * abl.meshCount.asFloat();
+
+    const grid_count_t pt_index = AdaptiveProbe::probed + 1;
+    if (abl.verbose_level) SERIAL_ECHOLNPGM("Probing mesh point ", x, ",", y, " (", pt_index, ").");
+    TERN_(HAS_STATUS_MESSAGE, ui.status_printf(0, F(S_FMT " %i/%i"), GET_TEXT(MSG_PROBING_POINT), int(pt_index), int(abl.abl_points)));
+
+    abl.measured_z = d.faux ? 0.001f * random(-100, 101) : probe.probe_at_point(abl.probePos, d.raise_after, abl.verbose_level);
+    if (isnan(abl.measured_z)) return NAN;
+
+    const float z = abl.measured_z + abl.Z_offset;
+    TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(abl.meshCount, z));
+
+    abl.reenable = false; // Don't re-enable after modifying the mesh
+    idle_no_sleep();
+    return z;
+  }
+
+#endif
+
 /**
  * G29: Detailed Z probe, probes the bed at 3 or more points.
  *      Will fail if the printer has not been homed with G28.
@@ -197,6 +242,11 @@ public:
  *
  *  Z  Supply an additional Z probe offset
  *
+ * Parameters with G29_ADAPTIVE_PROBING only:
+ *
+ *  U  Refine the coarse grid where the bed strays from a plane by more than U mm.
+ *     Default G29_ADAPTIVE_TOLERANCE. Use 'G29 U0' to probe every point.
+ *
  * Extra parameters with PROBE_MANUALLY:
  *
  *  To do manual probing simply repeat G29 until the procedure is complete.
@@ -380,6 +430,8 @@ G29_TYPE GcodeSuite::G29() {
 
       abl.Z_offset = parser.linearval('Z');
 
+      TERN_(G29_ADAPTIVE_PROBING, abl.adaptive_tolerance = parser.linearval('U', G29_ADAPTIVE_TOLERANCE));
+
     #endif
 
     #if ABL_USES_GRID
@@ -655,11 +707,70 @@ G29_TYPE GcodeSuite::G29() {
 
     #if ABL_USES_GRID
 
+      #if ENABLED(G29_ADAPTIVE_PROBING)
+        const bool adaptive = abl.adaptive_tolerance > 0;
+        if (adaptive) {
+          adaptive_g29_t data = { abl, raise_after, faux };
+          #if ENABLED(PROBE_PATH_PLANNER)
+            const millis_t start_ms = millis();
+            ProbePath::set_grid(abl.probe_position_lf, abl.gridSpacing, XY_PROBE_FEEDRATE_MM_S);
+          #endif
+          if (!AdaptiveProbe::probe_grid(abl.z_values, abl.adaptive_tolerance, adaptive_probe_point, &data))
+            set_bed_leveling_enabled(abl.reenable);
+          else {
+            SERIAL_ECHOLNPGM("Probed ", AdaptiveProbe::probed, " of ", abl.abl_points, " mesh points.");
+            TERN_(PROBE_PATH_PLANNER, ProbePath::report(start_ms));
+          }
+        }
+      #else
+        constexpr bool adaptive = false;
+      #endif
+
+      // Probe the mesh point at meshCount. Return false if probing failed.
+      auto probe_mesh_point = [&](const grid_count_t pt_index) {
+        abl.probePos = abl.probe_position_lf + abl.gridSpacing * abl.meshCount.asFloat();
+
+        if (abl.verbose_level) SERIAL_ECHOLNPGM("Probing mesh point ", pt_index, "/", abl.abl_points, ".");
+        TERN_(HAS_STATUS_MESSAGE, ui.status_printf(0, F(S_FMT " %i/%i"), GET_TEXT(MSG_PROBING_POINT), int(pt_index), int(abl.abl_points)));
+
+        abl.measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(abl.probePos, raise_after, abl.verbose_level);
+
+        if (isnan(abl.measured_z)) {
+          set_bed_leveling_enabled(abl.reenable);
+          return false;
+        }
+
+        #if ENABLED(AUTO_BED_LEVELING_LINEAR)
+
+          const int index = abl.indexIntoAB[abl.meshCount.x][abl.meshCount.y];
+          abl.mean += abl.measured_z;
+          abl.eqnBVector[index] = abl.measured_z;
+          abl.eqnAMatrix[index + 0 * abl.abl_points] = abl.probePos.x;
+          abl.eqnAMatrix[index + 1 * abl.abl_points] = abl.probePos.y;
+          abl.eqnAMatrix[index + 2 * abl.abl_points] = 1;
+
+          incremental_LSF(&lsf_results, abl.probePos, abl.measured_z);
+
+        #elif ENABLED(AUTO_BED_LEVELING_BILINEAR)
+
+          const float z = abl.measured_z + abl.Z_offset;
+          abl.z_values[abl.meshCount.x][abl.meshCount.y] = z;
+          TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(abl.meshCount, z));
+
+        #endif
+
+        abl.reenable = false; // Don't re-enable after modifying the mesh
+        idle_no_sleep();
+        return true;
+      };
+
+      TERN_(PROBE_PATH_PLANNER, ProbePath::reset());
+
       bool zig = PR_OUTER_SIZE & 1;  // Always end at RIGHT and BACK_PROBE_BED_POSITION
 
       // Outer loop is X with PROBE_Y_FIRST enabled
       // Outer loop is Y with PROBE_Y_FIRST disabled
-      for (PR_OUTER_VAR = 0; PR_OUTER_VAR < PR_OUTER_SIZE && !isnan(abl.measured_z); PR_OUTER_VAR++) {
+      for (PR_OUTER_VAR = 0; !adaptive && PR_OUTER_VAR < PR_OUTER_SIZE && !isnan(abl.measured_z); PR_OUTER_VAR++) {
 
         int8_t inStart, inStop, inInc;
 
@@ -690,40 +801,28 @@ G29_TYPE GcodeSuite::G29() {
           // Avoid probing outside the round or hexagonal area
           if (TERN0(IS_KINEMATIC, !probe.can_reach(abl.probePos))) continue;
 
-          if (abl.verbose_level) SERIAL_ECHOLNPGM("Probing mesh point ", pt_index, "/", abl.abl_points, ".");
-          TERN_(HAS_STATUS_MESSAGE, ui.status_printf(0, F(S_FMT " %i/%i"), GET_TEXT(MSG_PROBING_POINT), int(pt_index), int(abl.abl_points)));
-
-          abl.measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(abl.probePos, raise_after, abl.verbose_level);
-
-          if (isnan(abl.measured_z)) {
-            set_bed_leveling_enabled(abl.reenable);
-            break; // Breaks out of both loops
-          }
-
-          #if ENABLED(AUTO_BED_LEVELING_LINEAR)
-
-            abl.mean += abl.measured_z;
-            abl.eqnBVector[abl.abl_probe_index] = abl.measured_z;
-            abl.eqnAMatrix[abl.abl_probe_index + 0 * abl.abl_points] = abl.probePos.x;
-            abl.eqnAMatrix[abl.abl_probe_index + 1 * abl.abl_points] = abl.probePos.y;
-            abl.eqnAMatrix[abl.abl_probe_index + 2 * abl.abl_points] = 1;
-
-            incremental_LSF(&lsf_results, abl.probePos, abl.measured_z);
-
-          #elif ENABLED(AUTO_BED_LEVELING_BILINEAR)
-
-            const float z = abl.measured_z + abl.Z_offset;
-            abl.z_values[abl.meshCount.x][abl.meshCount.y] = z;
-            TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(abl.meshCount, z));
-
+          #if ENABLED(PROBE_PATH_PLANNER)
+            ProbePath::add(abl.meshCount.x, abl.meshCount.y); // Probe later in the planned order
+          #else
+            if (!probe_mesh_point(pt_index)) break; // Breaks out of both loops
           #endif
 
-          abl.reenable = false; // Don't re-enable after modifying the mesh
-          idle_no_sleep();
-
         } // inner
       } // outer
 
+      #if ENABLED(PROBE_PATH_PLANNER)
+        if (!adaptive) {
+          const millis_t start_ms = millis();
+          ProbePath::set_grid(abl.probe_position_lf, abl.gridSpacing, XY_PROBE_FEEDRATE_MM_S);
+          ProbePath::plan(xy_pos_t(current_position) + probe.offset_xy);
+          for (grid_count_t n = 0; n < ProbePath::count; ++n) {
+            abl.meshCount.set(ProbePath::points[n].x, ProbePath::points[n].y);
+            if (!probe_mesh_point(n + 1)) break;
+          }
+          if (!isnan(abl.measured_z)) ProbePath::report(start_ms);
+        }
+      #endif
+
     #elif ENABLED(AUTO_BED_LEVELING_3POINT)
 
       // Probe at 3 arbitrary points
@@ -67,6 +67,11 @@ void GcodeSuite::M305() {
     if (parser.seenval('C')) // Steinhart-Hart C coefficient
       if (!thermalManager.set_sh_coeff(t_index, parser.value_float()))
         SERIAL_ECHO_MSG("!Invalid Steinhart-Hart C coeff. (-0.01 < C < +0.01)");
+
+    // Rebuild the lookup table now rather than in the middle of a temperature update
+    #if HAS_USER_THERMISTOR_TABLE
+      if (thermalManager.user_thermistor[t_index].pre_calc) thermalManager.update_user_thermistor(t_index);
+    #endif
   }                       // If not setting then report parameters
   else if (t_index < 0) { // ...all user thermistors
     LOOP_L_N(i, USER_THERMISTORS)
@@ -103,9 +103,12 @@ void say_shaping() {
 
   #if HAS_EXTRUDERS
     SERIAL_ECHO_TERNARY(fxdTiCtrl.cfg.linearAdvEna, "Linear Advance ", "en", "dis", "abled");
-    SERIAL_ECHOLNPGM(". Gain: "); SERIAL_ECHO_F(fxdTiCtrl.cfg.linearAdvK, 5);
+    SERIAL_ECHOPGM(". Gain: "); SERIAL_ECHO_F(fxdTiCtrl.cfg.linearAdvK, 5);
+    SERIAL_EOL();
   #endif
 
+  SERIAL_ECHOLNPGM("Stepper buffer underruns: ", fxdTiCtrl.underruns);
+
 }
 
 void GcodeSuite::M493_report(const bool forReplay/*=true*/) {
@@ -166,6 +169,9 @@ void GcodeSuite::M493() {
 
   if (!parser.seen_any()) flag.report_h = true;
 
+  // Keep the producer out until the new settings are all applied
+  fxdTiCtrl.holdTask(true);
+
   // Parse 'S' mode parameter.
   if (parser.seenval('S')) {
     const ftMotionMode_t oldmm = fxdTiCtrl.cfg.mode,
@@ -187,6 +193,7 @@ void GcodeSuite::M493() {
         break;
       default:
         SERIAL_ECHOLNPGM("?Invalid control mode [M] value.");
+        fxdTiCtrl.holdTask(false);
         return;
     }
 
@@ -340,6 +347,7 @@ void GcodeSuite::M493() {
     if (flag.update_a) fxdTiCtrl.updateShapingA();
   #endif
   if (flag.reset_ft) fxdTiCtrl.reset();
+  fxdTiCtrl.holdTask(false);
   if (flag.report_h) say_shaping();
 
 }
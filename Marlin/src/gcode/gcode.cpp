@@ -1134,7 +1134,8 @@ void GcodeSuite::process_next_command() {
 
   TERN_(POWER_LOSS_RECOVERY, recovery.queue_index_r = queue.ring_buffer.index_r);
 
-  if (DEBUGGING(ECHO)) {
+  // Binary packets aren't text, so don't echo them
+  if (DEBUGGING(ECHO) && TERN1(BINARY_GCODE, uint8_t(command.buffer[0]) != BINARY_GCODE_SYNC)) {
     SERIAL_ECHO_START();
     SERIAL_ECHOLN(command.buffer);
     #if ENABLED(M100_FREE_MEMORY_DUMPER)
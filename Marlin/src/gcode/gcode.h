@@ -323,6 +323,7 @@
  *
  * D... - Custom Development G-code. Add hooks to 'gcode_D.cpp' for developers to test features. (Requires MARLIN_DEV_MODE)
  *        D576 - Set buffer monitoring options. (Requires BUFFER_MONITORING)
+ *        D580 - Trace stepper pulses. (Requires STEP_TRACE)
  *
  *** "T" Codes ***
  *
@@ -30,6 +30,10 @@
   #include "queue.h"
 #endif
 
+#if ENABLED(STEP_TRACE)
+  #include "../feature/step_trace.h"
+#endif
+
 #include "../module/settings.h"
 #include "../module/temperature.h"
 #include "../libs/hex_print.h"
@@ -279,7 +283,7 @@ void GcodeSuite::D(const int16_t dcode) {
        * Usage: D576 [S<seconds>]
        *
        * With no parameters emits the following output:
-       * "D576 P<nn> B<nn> PU<nn> PD<nn> BU<nn> BD<nn>"
+       * "D576 P<nn> B<nn> PU<nn> PD<nn> BU<nn> BD<nn> K<nn> KS<nn>"
        * Where:
        *   P : Planner buffers free
        *   B : Command buffers free
@@ -287,6 +291,10 @@ void GcodeSuite::D(const int16_t dcode) {
        *   PD: Longest duration (ms) the planner buffer was empty (since the last report)
        *   BU: Command buffer underruns (since the last report)
        *   BD: Longest duration (ms) command buffer was empty (since the last report)
+       *   K : Planner kernel calls (since the last report)
+       *   KS: Planner kernel calls skipped due to a stable plan prefix (since the last report)
+       *   G1: G1 moves in and moves out of SEGMENT_MERGING / ARC_FITTING (since the last report)
+       *   A : Arcs fitted by ARC_FITTING (since the last report)
        */
       case 576: {
         if (parser.seenval('S'))
@@ -297,6 +305,39 @@ void GcodeSuite::D(const int16_t dcode) {
       }
 
     #endif // BUFFER_MONITORING
+
+    #if ENABLED(STEP_TRACE)
+
+      /**
+       * D580: Trace the step pulses sent by the stepper ISR.
+       * Usage: D580 [S<mode>]
+       *
+       *   S1: Record and send events as they come. Events that don't fit while the
+       *       serial port catches up are dropped, and marked with "# dropped <count>".
+       *   S2: Record and send events until one doesn't fit, for a trace with no gaps.
+       *   S0: Stop recording. The events held are still sent.
+       *
+       * With no parameters report whether recording and the counts of events recorded and dropped.
+       */
+      case 580: {
+        if (parser.seenval('S')) {
+          const uint8_t mode = parser.value_byte();
+          if (mode) {
+            // End a trace that is still being sent, with what it managed to send
+            if (step_trace.serial_out) step_trace.report_status();
+            step_trace.report_header();
+            step_trace.start(mode == 2);
+            step_trace.serial_out = true;
+          }
+          else
+            step_trace.stop();
+        }
+        else
+          step_trace.report_status();
+        break;
+      }
+
+    #endif // STEP_TRACE
   }
 }
 
@@ -104,6 +104,9 @@ void GcodeSuite::M115() {
     // BINARY_FILE_TRANSFER (M28 B1)
     cap_line(F("BINARY_FILE_TRANSFER"), ENABLED(BINARY_FILE_TRANSFER)); // TODO: Use SERIAL_IMPL.has_feature(port, SerialFeature::BinaryFileTransfer) once implemented
 
+    // BINARY_GCODE (Pre-parsed binary command packets)
+    cap_line(F("BINARY_GCODE"), ENABLED(BINARY_GCODE));
+
     // EEPROM (M500, M501)
     cap_line(F("EEPROM"), ENABLED(EEPROM_SETTINGS));
 
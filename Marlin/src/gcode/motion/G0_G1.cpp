@@ -31,6 +31,10 @@
 
 #include "../../sd/cardreader.h"
 
+#if HAS_SEGMENT_MERGE
+  #include "../../feature/segment_merge.h"
+#endif
+
 #if ENABLED(NANODLP_Z_SYNC)
   #include "../../module/planner.h"
 #endif
@@ -91,11 +95,16 @@ void GcodeSuite::G0_G1(TERN_(HAS_FAST_MOVES, const bool fast_move/*=false*/)) {
 
   #endif // FWRETRACT
 
-  #if EITHER(IS_SCARA, POLAR)
-    fast_move ? prepare_fast_move_to_destination() : prepare_line_to_destination();
-  #else
-    prepare_line_to_destination();
-  #endif
+  // Extend the move with queued G1 moves that continue along the same line or arc
+  const bool planned = TERN0(HAS_SEGMENT_MERGE, !TERN0(HAS_FAST_MOVES, fast_move) && segment_merge.merge_queued_moves());
+
+  if (!planned) {
+    #if EITHER(IS_SCARA, POLAR)
+      fast_move ? prepare_fast_move_to_destination() : prepare_line_to_destination();
+    #else
+      prepare_line_to_destination();
+    #endif
+  }
 
   #ifdef G0_FEEDRATE
     // Restore the motion mode feedrate
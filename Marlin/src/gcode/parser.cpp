@@ -66,6 +66,11 @@ uint16_t GCodeParser::codenum;
   char *GCodeParser::command_args; // start of parameters
 #endif
 
+#if ENABLED(BINARY_GCODE)
+  bool GCodeParser::binary;
+  const uint8_t GCodeParser::binary_value_size[BGC_MILLI24 + 1] = { 0, 1, 2, 4, 4, 2, 3 };
+#endif
+
 // Create a global instance of the GCode parser singleton
 GCodeParser parser;
 
@@ -84,6 +89,7 @@ void GCodeParser::reset() {
     codebits = 0;                       // No codes yet
     //ZERO(param);                      // No parameters (should be safe to comment out this line)
   #endif
+  TERN_(BINARY_GCODE, binary = false);  // Text until proven otherwise
 }
 
 #if ENABLED(GCODE_QUOTED_STRINGS)
@@ -114,6 +120,10 @@ void GCodeParser::parse(char *p) {
 
   reset(); // No codes to report
 
+  #if ENABLED(BINARY_GCODE)
+    if (uint8_t(*p) == BINARY_GCODE_SYNC) return parse_binary(p);
+  #endif
+
   auto uppercase = [](char c) {
     if (TERN0(GCODE_CASE_INSENSITIVE, WITHIN(c, 'a', 'z')))
       c += 'A' - 'a';
@@ -363,10 +373,84 @@ void GCodeParser::parse(char *p) {
   }
 }
 
+#if ENABLED(BINARY_GCODE)
+
+  /**
+   * Populate the command line state from a queued binary packet.
+   * Parameters point at their type tags. Values are only decoded when used.
+   */
+  void GCodeParser::parse_binary(char * const p) {
+    const uint8_t *b = (uint8_t*)p + 1;
+    const uint8_t * const end = b + 1 + *b;
+    const uint8_t head = *++b;
+    ++b;
+
+    binary = true;
+    command_ptr = p;
+
+    if (TEST(head, BGC_LINE_NUMBER)) b += 4;  // Checked on receipt
+    codenum = *b++;
+    if (TEST(head, BGC_CODE16)) codenum |= uint16_t(*b++) << 8;
+    if (TEST(head, BGC_SUBCODE)) { TERN_(USE_GCODE_SUBCODES, subcode = *b); ++b; }
+
+    const char letter = "GMTD"[head & 0x03];
+    if (letter == 'D' && DISABLED(MARLIN_DEV_MODE)) return;
+    command_letter = letter;
+
+    #if ENABLED(GCODE_MOTION_MODES)
+      if (letter == 'G'
+        && (codenum <= TERN(ARC_SUPPORT, 3, 1) || TERN0(BEZIER_CURVE_SUPPORT, codenum == 5) || TERN0(G38_PROBE_TARGET, codenum == 38))
+      ) {
+        motion_mode_codenum = codenum;
+        TERN_(USE_GCODE_SUBCODES, motion_mode_subcode = subcode);
+      }
+    #endif
+
+    while (b < end) {
+      const uint8_t type = *b >> 5;
+      if (type > BGC_MILLI24) break;          // Unknown type. Ignore the rest.
+      set('A' + (*b & 0x1F), type == BGC_FLAG ? nullptr : (char*)b);
+      b += 1 + binary_value_size[type];
+    }
+  }
+
+  // Decode the value at value_ptr as an integer, truncating like strtol
+  int32_t GCodeParser::binary_value_long() {
+    const uint8_t * const v = (uint8_t*)value_ptr + 1;
+    switch (uint8_t(*value_ptr) >> 5) {
+      case BGC_INT8:    return int8_t(v[0]);
+      case BGC_INT16:   return int16_t(v[0] | v[1] << 8);
+      case BGC_INT32:   return binary_int32(v);
+      case BGC_FLOAT:   return int32_t(binary_value_float());
+      case BGC_MILLI16: return int16_t(v[0] | v[1] << 8) / 1000;
+      case BGC_MILLI24: return (int32_t(uint32_t(v[0] | v[1] << 8 | uint32_t(v[2]) << 16) << 8) >> 8) / 1000;
+      default:          return 0;
+    }
+  }
+
+  // Decode the value at value_ptr as a float, rounded like strtof
+  float GCodeParser::binary_value_float() {
+    const uint8_t * const v = (uint8_t*)value_ptr + 1;
+    switch (uint8_t(*value_ptr) >> 5) {
+      case BGC_FLOAT: {
+        const uint32_t u = binary_int32(v);
+        float f;
+        memcpy(&f, &u, sizeof(f));
+        return f;
+      }
+      case BGC_MILLI16: return int16_t(v[0] | v[1] << 8) / 1000.0f;
+      case BGC_MILLI24: return (int32_t(uint32_t(v[0] | v[1] << 8 | uint32_t(v[2]) << 16) << 8) >> 8) / 1000.0f;
+      default:          return binary_value_long();
+    }
+  }
+
+#endif // BINARY_GCODE
+
 #if ENABLED(CNC_COORDINATE_SYSTEMS)
 
   // Parse the next parameter as a new command
   bool GCodeParser::chain() {
+    if (TERN0(BINARY_GCODE, binary)) return false;  // Binary packets hold a single command
     #if ENABLED(FASTER_GCODE_PARSER)
       char *next_command = command_ptr;
       if (next_command) {
@@ -383,6 +467,97 @@ void GCodeParser::parse(char *p) {
 
 #endif // CNC_COORDINATE_SYSTEMS
 
+#if ENABLED(MARLIN_TEST_BUILD) && ENABLED(BINARY_GCODE)
+
+  #include "../tests/marlin_tests.h"
+
+  /**
+   * Parse the same G1 moves as text and as binary packets, compare
+   * the values they give, then time parsing and reading them both ways.
+   */
+  void GCodeParser::test_binary_gcode() {
+    constexpr uint8_t move_count = 10;
+    constexpr uint16_t test_count = 1000;
+    static const char letters[] = "XYZEF";
+
+    uint32_t seed = 12345;
+    auto rnd = [&seed](const int32_t lo, const int32_t hi) { seed = seed * 1103515245UL + 12345UL; return lo + int32_t((seed >> 8) % uint32_t(hi - lo + 1)); };
+
+    // Encode a value given in thousandths with the smallest type, as the host encoder does
+    auto put_milli = [](uint8_t *&b, const char letter, const int32_t milli) {
+      const uint8_t ind = letter - 'A';
+      const int32_t whole = milli / 1000;
+      if (milli % 1000 == 0 && WITHIN(whole, -128, 127)) {
+        *b++ = BGC_INT8 << 5 | ind; *b++ = uint8_t(whole);
+      }
+      else if (milli % 1000 == 0 && WITHIN(whole, -32768, 32767)) {
+        *b++ = BGC_INT16 << 5 | ind; *b++ = uint8_t(whole); *b++ = uint8_t(whole >> 8);
+      }
+      else if (WITHIN(milli, -32768, 32767)) {
+        *b++ = BGC_MILLI16 << 5 | ind; *b++ = uint8_t(milli); *b++ = uint8_t(milli >> 8);
+      }
+      else if (WITHIN(milli, -8388608L, 8388607L)) {
+        *b++ = BGC_MILLI24 << 5 | ind; *b++ = uint8_t(milli); *b++ = uint8_t(milli >> 8); *b++ = uint8_t(milli >> 16);
+      }
+      else {
+        const float f = milli / 1000.0f;
+        uint32_t u;
+        memcpy(&u, &f, sizeof(u));
+        *b++ = BGC_FLOAT << 5 | ind; *b++ = uint8_t(u); *b++ = uint8_t(u >> 8); *b++ = uint8_t(u >> 16); *b++ = uint8_t(u >> 24);
+      }
+    };
+
+    static char text[move_count][MAX_CMD_SIZE], packet[move_count][MAX_CMD_SIZE];
+    uint16_t text_bytes = 0, packet_bytes = 0;
+    LOOP_L_N(m, move_count) {
+      const int32_t value[] = { rnd(0, 300000), rnd(0, 300000), rnd(0, 20000), rnd(-2000, 2000), rnd(10, 200) * 60000 };
+      char *t = text[m] + sprintf_P(text[m], PSTR("G1"));
+      uint8_t *b = (uint8_t*)packet[m] + 2;
+      *b++ = 0;   // G, 8-bit code
+      *b++ = 1;
+      LOOP_L_N(i, COUNT(value)) {
+        const int32_t v = value[i];
+        t += sprintf_P(t, PSTR(" %c%s%ld.%03ld"), letters[i], v < 0 ? "-" : "", long(ABS(v) / 1000), long(ABS(v) % 1000));
+        put_milli(b, letters[i], v);
+      }
+      packet[m][0] = char(BINARY_GCODE_SYNC);
+      packet[m][1] = char(b - (uint8_t*)packet[m] - 2);
+      text_bytes += strlen(text[m]) + 1;                // With a newline
+      packet_bytes += uint8_t(packet[m][1]) + 3;        // With a checksum
+    }
+
+    // Accuracy
+    uint16_t failures = 0;
+    LOOP_L_N(m, move_count) {
+      float ref[COUNT(letters) - 1];
+      parse(text[m]);
+      LOOP_L_N(i, COUNT(ref)) ref[i] = floatval(letters[i]);
+      const int32_t ref_f = longval('F');
+      parse(packet[m]);
+      bool ok = is_command('G', 1) && longval('F') == ref_f;
+      LOOP_L_N(i, COUNT(ref)) ok &= floatval(letters[i]) == ref[i];
+      if (!ok && ++failures <= 5) SERIAL_ECHOLNPGM("Binary G-code mismatch: ", text[m]);
+    }
+
+    // Speed of parsing and reading all the values
+    auto time_parse = [&](char (&cmd)[move_count][MAX_CMD_SIZE]) {
+      float sum = 0;
+      const uint32_t t = testMicros();
+      for (uint16_t n = 0; n < test_count; ++n) {
+        parse(cmd[n % move_count]);
+        LOOP_L_N(i, COUNT(letters) - 1) sum += floatval(letters[i]);
+      }
+      const uint32_t us = testMicros() - t;
+      return sum ? us : 0;   // Use the sum so the reads aren't optimized out
+    };
+    const uint32_t text_us = time_parse(text), packet_us = time_parse(packet);
+
+    countTestFailures(failures);
+    SERIAL_ECHOLNPGM("Binary G-code: ", test_count, " moves, ", failures, " mismatches, text ", text_bytes, " bytes ", text_us, "us, binary ", packet_bytes, " bytes ", packet_us, "us");
+  }
+
+#endif // MARLIN_TEST_BUILD && BINARY_GCODE
+
 void GCodeParser::unknown_command_warning() {
   SERIAL_ECHO_MSG(STR_UNKNOWN_COMMAND, command_ptr, "\"");
 }
@@ -42,6 +42,32 @@
   typedef enum : uint8_t { LINEARUNIT_MM, LINEARUNIT_INCH } LinearUnit;
 #endif
 
+#if ENABLED(BINARY_GCODE)
+  /**
+   * Binary G-code packets, pre-parsed by the host (buildroot/share/scripts/binary_gcode.py)
+   *
+   *   SYNC LEN PAYLOAD[LEN] CHECKSUM   CHECKSUM is the XOR of all the preceding bytes
+   *
+   * PAYLOAD:
+   *   HEAD       Bits 0-1: G, M, T, or D. Bit 2: 16-bit code. Bit 3: Subcode. Bit 4: Line number.
+   *   [N]        int32 line number
+   *   CODE       uint8 or uint16 code number
+   *   [SUBCODE]  uint8 subcode
+   *   PARAMS     Each a TAG byte (type << 5 | letter - 'A') followed by a value of that type
+   *
+   * Values are little-endian. A queued packet keeps SYNC, LEN, and PAYLOAD.
+   */
+  #define BINARY_GCODE_SYNC 0xB5
+  enum BinaryGcodeHead : uint8_t { BGC_CODE16 = 2, BGC_SUBCODE = 3, BGC_LINE_NUMBER = 4 };
+  enum BinaryGcodeType : uint8_t {
+    BGC_FLAG,     // No value
+    BGC_INT8, BGC_INT16, BGC_INT32,
+    BGC_FLOAT,    // IEEE 754 single
+    BGC_MILLI16,  // int16 / 1000
+    BGC_MILLI24   // int24 / 1000
+  };
+#endif
+
 /**
  * GCode parser
  *
@@ -66,8 +92,24 @@ private:
     static char *command_args;      // Args start here, for slow scan
   #endif
 
+  #if ENABLED(BINARY_GCODE)
+    static void parse_binary(char * const p);
+    static int32_t binary_value_long();
+    static float binary_value_float();
+  #endif
+
 public:
 
+  #if ENABLED(BINARY_GCODE)
+    static bool binary;             // The command came from a binary packet
+    static const uint8_t binary_value_size[BGC_MILLI24 + 1];
+
+    // Get a little-endian int32 from a binary packet
+    FORCE_INLINE static int32_t binary_int32(const uint8_t * const b) {
+      return int32_t(uint32_t(b[0]) | uint32_t(b[1]) << 8 | uint32_t(b[2]) << 16 | uint32_t(b[3]) << 24);
+    }
+  #endif
+
   // Global states for GCode-level units features
 
   static bool volumetric_enabled;
@@ -101,6 +143,10 @@ public:
     static void debug();
   #endif
 
+  #if ENABLED(MARLIN_TEST_BUILD) && ENABLED(BINARY_GCODE)
+    static void test_binary_gcode();
+  #endif
+
   // Reset is done before parsing
   static void reset();
 
@@ -149,7 +195,7 @@ public:
       if (b) {
         if (param[ind]) {
           char * const ptr = command_ptr + param[ind];
-          value_ptr = valid_number(ptr) ? ptr : nullptr;
+          value_ptr = (TERN0(BINARY_GCODE, binary) || valid_number(ptr)) ? ptr : nullptr;
         }
         else
           value_ptr = nullptr;
@@ -257,6 +303,7 @@ public:
   // Float removes 'E' to prevent scientific notation interpretation
   static float value_float() {
     if (!value_ptr) return 0;
+    TERN_(BINARY_GCODE, if (binary) return binary_value_float());
     char *e = value_ptr;
     for (;;) {
       const char c = *e;
@@ -273,8 +320,16 @@ public:
   }
 
   // Code value as a long or ulong
-  static int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
-  static uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  static int32_t value_long() {
+    if (!value_ptr) return 0L;
+    TERN_(BINARY_GCODE, if (binary) return binary_value_long());
+    return strtol(value_ptr, nullptr, 10);
+  }
+  static uint32_t value_ulong() {
+    if (!value_ptr) return 0UL;
+    TERN_(BINARY_GCODE, if (binary) return uint32_t(binary_value_long()));
+    return strtoul(value_ptr, nullptr, 10);
+  }
 
   // Code value for use as time
   static millis_t value_millis() { return value_ulong(); }
@@ -431,7 +486,7 @@ public:
   #if ENABLED(MARLIN_DEV_MODE)
 
     static uint8_t* hex_adr_val(const char c, uint8_t * const dval=nullptr) {
-      if (!seen(c) || *value_ptr != 'x') return dval;
+      if (!seen(c) || TERN0(BINARY_GCODE, binary) || *value_ptr != 'x') return dval;
       uint8_t *out = nullptr;
       for (char *vp = value_ptr + 1; HEXCHR(*vp) >= 0; vp++)
         out = (uint8_t*)((uintptr_t(out) << 8) | HEXCHR(*vp));
@@ -439,7 +494,7 @@ public:
     }
 
     static uint16_t hex_val(const char c, uint16_t const dval=0) {
-      if (!seen(c) || *value_ptr != 'x') return dval;
+      if (!seen(c) || TERN0(BINARY_GCODE, binary) || *value_ptr != 'x') return dval;
       uint16_t out = 0;
       for (char *vp = value_ptr + 1; HEXCHR(*vp) >= 0; vp++)
         out = ((out) << 8) | HEXCHR(*vp);
@@ -37,6 +37,10 @@ GCodeQueue queue;
 #include "../MarlinCore.h"
 #include "../core/bug_on.h"
 
+#if HAS_SEGMENT_MERGE
+  #include "../feature/segment_merge.h"
+#endif
+
 #if ENABLED(PRINTER_EVENT_LEDS)
   #include "../feature/leds/printer_event_leds.h"
 #endif
@@ -99,9 +103,40 @@ PGM_P GCodeQueue::injected_commands_P; // = nullptr
  */
 char GCodeQueue::injected_commands[64]; // = { 0 }
 
+#if COMMAND_BUFFER_SIZE
+
+  bool GCodeQueue::RingBuffer::text_space(const uint16_t need, uint16_t &w) const {
+    // Text is used from the oldest command up to text_w, possibly wrapping around
+    w = text_w;
+    if (length == 0 || text_w > uint16_t(commands[index_r].buffer - text)) {
+      // Free space at the end, then from the start up to the oldest command
+      if (w + need > COMMAND_BUFFER_SIZE) {
+        w = 0;
+        if (length && need > uint16_t(commands[index_r].buffer - text)) return false;
+      }
+    }
+    else if (need > uint16_t(commands[index_r].buffer - text) - w)
+      return false;           // Wrapped, with free space up to the oldest command
+    return true;
+  }
+
+  bool GCodeQueue::RingBuffer::reserve_text(const uint16_t need) {
+    uint16_t w;
+    if (!text_space(need, w)) return false;
+    commands[index_w].buffer = text + w;
+    return true;
+  }
+
+#endif
+
 void GCodeQueue::RingBuffer::commit_command(const bool skip_ok
   OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind/*=-1*/)
 ) {
+  #if COMMAND_BUFFER_SIZE
+    const char * const cmd = commands[index_w].buffer;
+    const bool is_binary = TERN0(BINARY_GCODE, uint8_t(cmd[0]) == BINARY_GCODE_SYNC);
+    text_w = cmd - text + (is_binary ? uint8_t(cmd[1]) + 3 : strlen(cmd) + 1);
+  #endif
   commands[index_w].skip_ok = skip_ok;
   TERN_(HAS_MULTI_SERIAL, commands[index_w].port = serial_ind);
   TERN_(POWER_LOSS_RECOVERY, recovery.commit_sdpos(index_w));
@@ -116,12 +151,37 @@ void GCodeQueue::RingBuffer::commit_command(const bool skip_ok
 bool GCodeQueue::RingBuffer::enqueue(const char *cmd, const bool skip_ok/*=true*/
   OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind/*=-1*/)
 ) {
-  if (*cmd == ';' || length >= BUFSIZE) return false;
+  if (*cmd == ';' || full()) return false;
+  #if COMMAND_BUFFER_SIZE
+    reserve_text(strlen(cmd) + 1);
+  #endif
   strcpy(commands[index_w].buffer, cmd);
   commit_command(skip_ok OPTARG(HAS_MULTI_SERIAL, serial_ind));
   return true;
 }
 
+#if ENABLED(BINARY_GCODE)
+
+  /**
+   * Copy a binary packet (SYNC, LEN, PAYLOAD) into the main command buffer.
+   * Return false for a full buffer.
+   */
+  bool GCodeQueue::RingBuffer::enqueue_binary(const char *packet, const bool skip_ok
+    OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind/*=-1*/)
+  ) {
+    if (full()) return false;
+    const uint8_t size = uint8_t(packet[1]) + 2;
+    #if COMMAND_BUFFER_SIZE
+      reserve_text(size + 1);
+    #endif
+    memcpy(commands[index_w].buffer, packet, size);
+    commands[index_w].buffer[size] = '\0';   // For anything that reads it as a string
+    commit_command(skip_ok OPTARG(HAS_MULTI_SERIAL, serial_ind));
+    return true;
+  }
+
+#endif
+
 /**
  * Enqueue with Serial Echo
  * Return true if the command was consumed
@@ -340,8 +400,9 @@ FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", b
 #define PS_QUOTED 2
 #define PS_PAREN  3
 #define PS_ESC    4
+#define PS_BINARY 8
 
-inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+inline void process_stream_char(const char c, uint8_t &sis, char * const buff, int &ind) {
 
   if (sis == PS_EOL) return;    // EOL comment or overflow
 
@@ -397,7 +458,7 @@ inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD
  * Handle a line being completed. For an empty line
  * keep sensor readings going and watchdog alive.
  */
-inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+inline bool process_line_done(uint8_t &sis, char * const buff, int &ind) {
   sis = PS_NORMAL;                    // "Normal" Serial Input State
   buff[ind] = '\0';                   // Of course, I'm a Terminator.
   const bool is_empty = (ind == 0);   // An empty line?
@@ -465,6 +526,62 @@ void GCodeQueue::get_serial_commands() {
       const char serial_char = (char)c;
       SerialState &serial = serial_state[p];
 
+      #if ENABLED(BINARY_GCODE)
+        // A binary packet starts with a byte that can't start a line of text
+        if (serial.input_state == PS_BINARY || (serial.count == 0 && serial.input_state == PS_NORMAL && uint8_t(serial_char) == BINARY_GCODE_SYNC)) {
+          serial.input_state = PS_BINARY;
+          serial.line_buffer[serial.count++] = serial_char;
+          if (serial.count < 2) continue;
+
+          const uint8_t len = serial.line_buffer[1];
+          if (!WITHIN(len, 2, MAX_CMD_SIZE - 3)) {
+            serial.input_state = PS_NORMAL;
+            gcode_line_error(F(STR_ERR_CHECKSUM_MISMATCH), p);
+            break;
+          }
+          if (serial.count < len + 3) continue;
+
+          serial.input_state = PS_NORMAL;
+          serial.count = 0;
+
+          uint8_t checksum = 0;
+          LOOP_L_N(i, len + 2) checksum ^= serial.line_buffer[i];
+          if (checksum != uint8_t(serial.line_buffer[len + 2])) {
+            gcode_line_error(F(STR_ERR_CHECKSUM_MISMATCH), p);
+            break;
+          }
+
+          #if HAS_MEDIA
+            // M28 writes commands to the file as text, so ask for this one again
+            if (card.flag.saving) {
+              gcode_line_error(F(STR_ERR_BINARY_SAVING), p);
+              break;
+            }
+          #endif
+
+          // The line number must be in sequence, except for M110
+          const uint8_t head = serial.line_buffer[2];
+          if (TEST(head, BGC_LINE_NUMBER)) {
+            const long gcode_N = GCodeParser::binary_int32((uint8_t*)&serial.line_buffer[3]);
+            const bool M110 = (head & 0x03) == 1 && !TEST(head, BGC_CODE16) && uint8_t(serial.line_buffer[7]) == 110;
+            if (gcode_N != serial.last_N + 1 && !M110) {
+              if (WITHIN(gcode_N, serial.last_N - 1, serial.last_N)) continue;
+              gcode_line_error(F(STR_ERR_LINE_NO), p);
+              break;
+            }
+            serial.last_N = gcode_N;
+          }
+
+          #if NO_TIMEOUTS > 0
+            last_command_time = ms;
+          #endif
+
+          // Add the packet to the queue. Critical commands (e.g., M112) should be sent as text.
+          ring_buffer.enqueue_binary(serial.line_buffer, false OPTARG(HAS_MULTI_SERIAL, p));
+          continue;
+        }
+      #endif
+
       if (ISEOL(serial_char)) {
 
         // Reset our state, continue if the line was empty
@@ -504,6 +621,9 @@ void GCodeQueue::get_serial_commands() {
               gcode_line_error(F(STR_ERR_CHECKSUM_MISMATCH), p);
               break;
             }
+            // Drop the checksum and trailing spaces so they aren't queued or scanned again
+            while (apos > command && apos[-1] == ' ') --apos;
+            *apos = '\0';
           }
           else {
             gcode_line_error(F(STR_ERR_NO_CHECKSUM), p);
@@ -580,7 +700,19 @@ void GCodeQueue::get_serial_commands() {
     while (!ring_buffer.full() && !card.eof()) {
       const int16_t n = card.get();
       const bool card_eof = card.eof();
-      if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
+      if (n < 0 && !card_eof) {
+        SERIAL_ERROR_MSG(STR_SD_ERR_READ);
+        #if ENABLED(HEATSHRINK_GCODE)
+          // A compressed file can't go on past a bad read, so abort the print
+          if (card.isCompressed()) { sd_input_state = PS_NORMAL; card.abortFilePrintSoon(); break; }
+        #endif
+        continue;
+      }
+
+      #if COMMAND_BUFFER_SIZE
+        // Each call reads whole lines, so place the new line's text as it starts
+        if (sd_count == 0) ring_buffer.reserve_text(MAX_CMD_SIZE);
+      #endif
 
       CommandLine &command = ring_buffer.commands[ring_buffer.index_w];
       const char sd_char = (char)n;
@@ -613,6 +745,9 @@ void GCodeQueue::get_serial_commands() {
       else
         process_stream_char(sd_char, sd_input_state, command.buffer, sd_count);
     }
+
+    // With the queue full there's time to read the next blocks before they're needed
+    TERN_(HAS_SD_READ_AHEAD, card.readAhead());
   }
 
 #endif // HAS_MEDIA
@@ -715,8 +850,17 @@ void GCodeQueue::advance() {
     SERIAL_ECHOLNPGM("D576"
       " P:", planner.moves_free(),         " ", -planner_buffer_underruns, " (", max_planner_buffer_empty_duration, ")"
       " B:", BUFSIZE - ring_buffer.length, " ", -command_buffer_underruns, " (", max_command_buffer_empty_duration, ")"
+      " K:", planner.kernel_calls, " KS:", planner.kernel_calls_skipped
+      #if HAS_SEGMENT_MERGE
+        , " G1:", segment_merge.segments_in, " ", segment_merge.moves_out
+      #endif
+      #if ENABLED(ARC_FITTING)
+        , " A:", segment_merge.arcs_out
+      #endif
     );
     command_buffer_underruns = planner_buffer_underruns = 0;
+    planner.kernel_calls = planner.kernel_calls_skipped = 0;
+    TERN_(HAS_SEGMENT_MERGE, segment_merge.reset_stats());
     max_command_buffer_empty_duration = max_planner_buffer_empty_duration = 0;
   }
 
@@ -746,3 +890,49 @@ void GCodeQueue::advance() {
   }
 
 #endif // BUFFER_MONITORING
+
+#if ENABLED(MARLIN_TEST_BUILD) && COMMAND_BUFFER_SIZE
+
+  #include "../tests/marlin_tests.h"
+
+  /**
+   * Push commands of random length through a packed ring buffer while
+   * reading them back, and check that every command comes out intact.
+   */
+  void GCodeQueue::test_command_buffer() {
+    constexpr uint16_t test_count = 2000;
+    static RingBuffer ring;
+    ring.clear();
+
+    // Deterministic pseudo-random commands, regenerated in the same order by the reader
+    uint32_t seed_w = 12345, seed_r = 12345, seed_op = 54321;
+    auto rnd = [](uint32_t &seed, const uint16_t n) { seed = seed * 1103515245UL + 12345UL; return uint16_t((seed >> 8) % n); };
+    auto make_cmd = [&](uint32_t &seed, char (&cmd)[MAX_CMD_SIZE], const uint16_t i) {
+      const uint16_t len = 4 + rnd(seed, rnd(seed, 4) ? 24 : MAX_CMD_SIZE - 5);  // Mostly short
+      sprintf_P(cmd, PSTR("M118 %u "), i);
+      for (uint16_t c = strlen(cmd); c < len; ++c) cmd[c] = 'A' + (i + c) % 26;
+      cmd[len] = '\0';
+    };
+
+    char cmd[MAX_CMD_SIZE];
+    uint16_t written = 0, read = 0, failures = 0;
+    uint8_t most_queued = 0;
+    while (read < test_count) {
+      if (written < test_count && rnd(seed_op, 3) && !ring.full()) {
+        make_cmd(seed_w, cmd, written++);
+        ring.enqueue(cmd);
+        NOLESS(most_queued, ring.length);
+      }
+      else if (ring.occupied()) {
+        make_cmd(seed_r, cmd, read++);
+        if (strcmp(ring.peek_next_command_string(), cmd) != 0 && ++failures <= 5)
+          SERIAL_ECHOLNPGM("Command buffer mismatch: ", ring.peek_next_command_string(), " / ", cmd);
+        ring.advance_pos(ring.index_r, -1);
+      }
+    }
+
+    countTestFailures(failures);
+    SERIAL_ECHOLNPGM("Command buffer: ", test_count, " commands, ", failures, " mismatches, up to ", most_queued, " queued in ", COMMAND_BUFFER_SIZE, " bytes");
+  }
+
+#endif // MARLIN_TEST_BUILD
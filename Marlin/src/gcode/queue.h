@@ -55,9 +55,16 @@ public:
    * (immediate, serial, sd card) and they are processed sequentially by
    * the main loop. The gcode.process_next_command method parses the next
    * command and hands off execution to individual handler functions.
+   *
+   * With COMMAND_BUFFER_SIZE the command strings are packed end to end
+   * in a shared byte ring, so each command only uses the RAM it needs.
    */
   struct CommandLine {
-    char buffer[MAX_CMD_SIZE];      //!< The command buffer
+    #if COMMAND_BUFFER_SIZE
+      char *buffer;                 //!< The command string, in the shared text buffer
+    #else
+      char buffer[MAX_CMD_SIZE];    //!< The command buffer
+    #endif
     bool skip_ok;                   //!< Skip sending ok when command is processed?
     #if HAS_MULTI_SERIAL
       serial_index_t port;          //!< Serial port the command was received on
@@ -73,9 +80,31 @@ public:
             index_w;                //!< Ring buffer's write position
     CommandLine commands[BUFSIZE];  //!< The ring buffer of commands
 
+    #if COMMAND_BUFFER_SIZE
+      char text[COMMAND_BUFFER_SIZE]; //!< The command strings, packed end to end
+      uint16_t text_w;                //!< Text position after the last committed command
+
+      /**
+       * Find 'need' contiguous free bytes of text for the next command, at text position 'w'.
+       * Return false if there's no room until more commands are processed.
+       */
+      bool text_space(const uint16_t need, uint16_t &w) const;
+
+      /**
+       * Point the write command's buffer at 'need' contiguous free bytes of text.
+       * Call before writing the command. Return false if there's no room.
+       */
+      bool reserve_text(const uint16_t need);
+    #endif
+
     inline serial_index_t command_port() const { return TERN0(HAS_MULTI_SERIAL, commands[index_r].port); }
 
-    inline void clear() { length = index_r = index_w = 0; }
+    inline void clear() {
+      length = index_r = index_w = 0;
+      #if COMMAND_BUFFER_SIZE
+        text_w = 0;
+      #endif
+    }
 
     void advance_pos(uint8_t &p, const int inc) { if (++p >= BUFSIZE) p = 0; length += inc; }
 
@@ -87,9 +116,20 @@ public:
       OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind = serial_index_t())
     );
 
+    #if ENABLED(BINARY_GCODE)
+      bool enqueue_binary(const char *packet, const bool skip_ok
+        OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind = serial_index_t())
+      );
+    #endif
+
     void ok_to_send();
 
-    inline bool full(uint8_t cmdCount=1) const { return length > (BUFSIZE - cmdCount); }
+    #if COMMAND_BUFFER_SIZE
+      // With packed text there must also be room for the longest commands
+      inline bool full(uint8_t cmdCount=1) const { uint16_t w; return length > (BUFSIZE - cmdCount) || !text_space(cmdCount * (MAX_CMD_SIZE), w); }
+    #else
+      inline bool full(uint8_t cmdCount=1) const { return length > (BUFSIZE - cmdCount); }
+    #endif
 
     inline bool occupied() const { return length != 0; }
 
@@ -234,6 +274,10 @@ public:
      *  PD<uint>  Max time in ms the planner buffer was empty since last report
      *  BU<uint>  Number of command buffer underruns since last report
      *  BD<uint>  Max time in ms the command buffer was empty since last report
+     *  K<uint>   Planner kernel calls since last report
+     *  KS<uint>  Planner kernel calls skipped (stable plan prefix) since last report
+     *  G1<uint>  G1 moves received / moves sent to the planner by SEGMENT_MERGING or ARC_FITTING since last report
+     *  A<uint>   Arcs sent to the planner by ARC_FITTING since last report
      */
     static void report_buffer_statistics();
 
@@ -252,6 +296,10 @@ public:
 
   #endif // BUFFER_MONITORING
 
+  #if ENABLED(MARLIN_TEST_BUILD) && COMMAND_BUFFER_SIZE
+    static void test_command_buffer();
+  #endif
+
 private:
 
   static void get_serial_commands();
@@ -330,6 +330,9 @@
 
 #if ANY_THERMISTOR_IS(1000)
   #define HAS_USER_THERMISTORS 1
+  #if USER_THERMISTOR_TABLE_SIZE
+    #define HAS_USER_THERMISTOR_TABLE 1
+  #endif
 #endif
 
 #if TEMP_SENSOR_REDUNDANT
@@ -834,6 +837,10 @@
   #define HAS_MEDIA_SUBCALLS 1
 #endif
 
+#if HAS_MEDIA && SD_READ_AHEAD_BLOCKS
+  #define HAS_SD_READ_AHEAD 1
+#endif
+
 #if ANY(SHOW_PROGRESS_PERCENT, SHOW_ELAPSED_TIME, SHOW_REMAINING_TIME, SHOW_INTERACTION_TIME)
   #define HAS_EXTRA_PROGRESS 1
 #endif
@@ -1222,7 +1229,7 @@
 #endif
 
 // Flag whether least_squares_fit.cpp is used
-#if ANY(AUTO_BED_LEVELING_UBL, AUTO_BED_LEVELING_LINEAR, HAS_Z_STEPPER_ALIGN_STEPPER_XY)
+#if ANY(AUTO_BED_LEVELING_UBL, AUTO_BED_LEVELING_LINEAR, G29_ADAPTIVE_PROBING, HAS_Z_STEPPER_ALIGN_STEPPER_XY)
   #define NEED_LSF 1
 #endif
 
@@ -1285,3 +1292,11 @@
 #if defined(REDUNDANT_PART_COOLING_FAN) && !defined(NUM_REDUNDANT_FANS)
   #define NUM_REDUNDANT_FANS 1
 #endif
+
+// G1 lookahead to merge moves into lines or arcs
+#if EITHER(SEGMENT_MERGING, ARC_FITTING)
+  #define HAS_SEGMENT_MERGE 1
+  #ifndef SEGMENT_MERGE_E_RATIO
+    #define SEGMENT_MERGE_E_RATIO 1
+  #endif
+#endif
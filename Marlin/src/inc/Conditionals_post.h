@@ -2376,6 +2376,16 @@
   #define HAS_PID_HEATING 1
 #endif
 
+// MPC power planned from upcoming extrusion
+#if ENABLED(MPCTEMP) && defined(MPC_FEEDFORWARD_LEAD)
+  #define HAS_MPC_FEEDFORWARD 1
+#endif
+
+// Heater PWM shared out under a total power limit
+#if defined(HEATER_POWER_BUDGET) && ANY(HAS_HOTEND, HAS_HEATED_BED, HAS_HEATED_CHAMBER)
+  #define HAS_POWER_BUDGET 1
+#endif
+
 #if ENABLED(DWIN_LCD_PROUI)
   #if EITHER(PIDTEMP, PIDTEMPBED)
     #define DWIN_PID_TUNE 1
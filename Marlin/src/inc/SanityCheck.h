@@ -235,6 +235,9 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
 #elif ANY(SERIAL_XON_XOFF, SERIAL_STATS_MAX_RX_QUEUED, SERIAL_STATS_DROPPED_RX)
   #error "SERIAL_XON_XOFF and SERIAL_STATS_* features not supported on USB-native AVR devices."
 #endif
+#if COMMAND_BUFFER_SIZE && !WITHIN(COMMAND_BUFFER_SIZE, 2 * (MAX_CMD_SIZE), 65535)
+  #error "COMMAND_BUFFER_SIZE must be from 2 * MAX_CMD_SIZE to 65535."
+#endif
 
 /**
  * Multiple Stepper Drivers Per Axis
@@ -993,6 +996,43 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #endif
 #endif
 
+#if HAS_MPC_FEEDFORWARD
+  static_assert(WITHIN(MPC_FEEDFORWARD_LEAD, 0.1f, 10.0f), "MPC_FEEDFORWARD_LEAD must be between 0.1 and 10 seconds.");
+#endif
+
+/**
+ * Heater Power Budget
+ */
+#if HAS_POWER_BUDGET
+  #if ENABLED(SLOW_PWM_HEATERS)
+    #error "HEATER_POWER_BUDGET is not compatible with SLOW_PWM_HEATERS."
+  #elif ENABLED(SOFT_PWM_DITHER)
+    #error "HEATER_POWER_BUDGET is not compatible with SOFT_PWM_DITHER."
+  #elif HAS_HEATED_BED && BED_HEATER_WATTS > HEATER_POWER_BUDGET
+    #error "BED_HEATER_WATTS must not exceed HEATER_POWER_BUDGET."
+  #elif HAS_HEATED_CHAMBER && CHAMBER_HEATER_WATTS > HEATER_POWER_BUDGET
+    #error "CHAMBER_HEATER_WATTS must not exceed HEATER_POWER_BUDGET."
+  #endif
+  #if HAS_HOTEND
+    constexpr float hhw[] = HOTEND_HEATER_WATTS;
+    static_assert(COUNT(hhw) == HOTENDS, "HOTEND_HEATER_WATTS must have exactly " STRINGIFY(HOTENDS) " values.");
+    #define _HHW_ASSERT(N) static_assert(N >= COUNT(hhw) || WITHIN(hhw[N], 1, HEATER_POWER_BUDGET), "HOTEND_HEATER_WATTS values must be from 1 to HEATER_POWER_BUDGET.");
+    REPEAT(HOTENDS, _HHW_ASSERT)
+    #undef _HHW_ASSERT
+  #endif
+#endif
+
+/**
+ * ADC DMA Ring
+ */
+#if ENABLED(ADC_DMA_RING)
+  #ifndef HAL_ADC_RING_DEPTH
+    #error "ADC_DMA_RING is not supported on this platform."
+  #elif !WITHIN(ADC_RING_UPDATE_LOOPS, 1, 16)
+    #error "ADC_RING_UPDATE_LOOPS must be between 1 and 16."
+  #endif
+#endif
+
 /**
  * Bed Heating Options - PID vs Limit Switching
  */
@@ -1047,12 +1087,41 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #error "CNC_WORKSPACE_PLANES currently requires a Z axis"
 #elif ENABLED(DIRECT_STEPPING) && NUM_AXES > XYZ
   #error "DIRECT_STEPPING does not currently support more than 3 axes (i.e., XYZ)."
+#elif ENABLED(SEGMENT_MERGING) && !HAS_Z_AXIS
+  #error "SEGMENT_MERGING requires a Z axis."
+#elif ENABLED(ARC_FITTING) && !HAS_Z_AXIS
+  #error "ARC_FITTING requires a Z axis."
 #elif ENABLED(FOAMCUTTER_XYUV) && !(HAS_I_AXIS && HAS_J_AXIS)
   #error "FOAMCUTTER_XYUV requires I and J steppers to be enabled."
 #elif ENABLED(LINEAR_ADVANCE) && HAS_I_AXIS
   #error "LINEAR_ADVANCE does not currently support the inclusion of an I axis."
 #endif
 
+/**
+ * G1 Segment Merging / Arc Fitting
+ */
+#if HAS_SEGMENT_MERGE
+  #if ENABLED(LASER_FEATURE)
+    #error "SEGMENT_MERGING and ARC_FITTING are not compatible with LASER_FEATURE."
+  #elif BOTH(MIXING_EXTRUDER, DIRECT_MIXING_IN_G1)
+    #error "SEGMENT_MERGING and ARC_FITTING are not compatible with DIRECT_MIXING_IN_G1."
+  #endif
+#endif
+#if ENABLED(SEGMENT_MERGING)
+  #if !WITHIN(SEGMENT_MERGE_MAX, 2, 32)
+    #error "SEGMENT_MERGE_MAX must be from 2 to 32."
+  #endif
+  static_assert(SEGMENT_MERGE_TOLERANCE > 0, "SEGMENT_MERGE_TOLERANCE must be greater than 0.");
+#endif
+#if ENABLED(ARC_FITTING)
+  #if DISABLED(ARC_SUPPORT)
+    #error "ARC_FITTING requires ARC_SUPPORT."
+  #elif !WITHIN(ARC_FIT_MAX, 3, 32)
+    #error "ARC_FIT_MAX must be from 3 to 32."
+  #endif
+  static_assert(ARC_FIT_TOLERANCE > 0, "ARC_FIT_TOLERANCE must be greater than 0.");
+#endif
+
 /**
  * Allow only extra axis codes that do not conflict with G-code parameter names
  */
@@ -1558,6 +1627,34 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #endif
 #endif
 
+#if ENABLED(MESH_BICUBIC)
+  #if NONE(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+    #error "MESH_BICUBIC requires AUTO_BED_LEVELING_BILINEAR or AUTO_BED_LEVELING_UBL."
+  #elif IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
+    #error "MESH_BICUBIC requires SEGMENT_LEVELED_MOVES."
+  #elif ENABLED(ABL_BILINEAR_SUBDIVISION)
+    #error "MESH_BICUBIC replaces ABL_BILINEAR_SUBDIVISION. Disable one or the other."
+  #elif ENABLED(ABL_BILINEAR_BOX_CACHE)
+    #error "ABL_BILINEAR_BOX_CACHE is not used with MESH_BICUBIC."
+  #endif
+#endif
+
+#if ENABLED(G29_ADAPTIVE_PROBING)
+  #if DISABLED(AUTO_BED_LEVELING_BILINEAR)
+    #error "G29_ADAPTIVE_PROBING requires AUTO_BED_LEVELING_BILINEAR."
+  #elif ENABLED(PROBE_MANUALLY)
+    #error "G29_ADAPTIVE_PROBING is not compatible with PROBE_MANUALLY."
+  #elif IS_KINEMATIC
+    #error "G29_ADAPTIVE_PROBING is not compatible with DELTA or SCARA."
+  #elif !defined(G29_ADAPTIVE_TOLERANCE)
+    #error "G29_ADAPTIVE_PROBING requires G29_ADAPTIVE_TOLERANCE."
+  #endif
+#endif
+
+#if ENABLED(PROBE_PATH_PLANNER) && NONE(AUTO_BED_LEVELING_LINEAR, AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL, G26_MESH_VALIDATION)
+  #error "PROBE_PATH_PLANNER requires AUTO_BED_LEVELING_LINEAR, BILINEAR, UBL, or G26_MESH_VALIDATION."
+#endif
+
 #if ENABLED(G29_RETRY_AND_RECOVER) && NONE(AUTO_BED_LEVELING_3POINT, AUTO_BED_LEVELING_LINEAR, AUTO_BED_LEVELING_BILINEAR)
   #error "G29_RETRY_AND_RECOVER requires AUTO_BED_LEVELING_3POINT, LINEAR, or BILINEAR."
 #endif
@@ -3804,6 +3901,30 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
 #if BOTH(HAS_MEATPACK, BINARY_FILE_TRANSFER)
   #error "Either enable MEATPACK_ON_SERIAL_PORT_* or BINARY_FILE_TRANSFER, not both."
 #endif
+#if ENABLED(BINARY_FILE_TRANSFER) && defined(BINARY_STREAM_WINDOW)
+  static_assert(WITHIN(BINARY_STREAM_WINDOW, 2, 16), "BINARY_STREAM_WINDOW must be from 2 to 16.");
+#endif
+
+#if HAS_USER_THERMISTOR_TABLE
+  static_assert(WITHIN(USER_THERMISTOR_TABLE_SIZE, 16, 128), "USER_THERMISTOR_TABLE_SIZE must be from 16 to 128.");
+#endif
+
+#if HAS_SD_READ_AHEAD
+  static_assert(WITHIN(SD_READ_AHEAD_BLOCKS, 2, 16), "SD_READ_AHEAD_BLOCKS must be from 2 to 16.");
+#endif
+
+/**
+ * Binary G-code
+ */
+#if ENABLED(BINARY_GCODE)
+  #if DISABLED(FASTER_GCODE_PARSER)
+    #error "BINARY_GCODE requires FASTER_GCODE_PARSER."
+  #elif HAS_MEATPACK
+    #error "Either enable MEATPACK_ON_SERIAL_PORT_* or BINARY_GCODE, not both."
+  #elif ENABLED(EMERGENCY_PARSER)
+    #error "BINARY_GCODE is not compatible with EMERGENCY_PARSER. (Packet bytes can spell M108, M112 or M410.)"
+  #endif
+#endif
 
 /**
  * Sanity Check for Slim LCD Menus and Probe Offset Wizard
@@ -4044,7 +4165,20 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
     #error "FT_MOTION is currently limited to machines with 3 linear axes."
   #elif ENABLED(MIXING_EXTRUDER)
     #error "FT_MOTION is incompatible with MIXING_EXTRUDER."
+  #elif ENABLED(FTM_TIMER_TASK) && defined(__AVR__)
+    #error "FTM_TIMER_TASK requires a 32-bit board, where the stepper ISR can preempt the temperature ISR."
+  #elif ENABLED(FTM_SCURVE) && !defined(FTM_MAX_JERK)
+    #error "FTM_SCURVE requires FTM_MAX_JERK."
   #endif
+#elif ENABLED(FTM_TIMER_TASK)
+  #error "FTM_TIMER_TASK requires FT_MOTION."
+#elif ENABLED(FTM_SCURVE)
+  #error "FTM_SCURVE requires FT_MOTION."
+#endif
+
+// Step Trace
+#if ENABLED(STEP_TRACE) && !IS_POWER_OF_2(STEP_TRACE_SIZE)
+  #error "STEP_TRACE_SIZE must be a power of 2."
 #endif
 
 // Multi-Stepping Limit
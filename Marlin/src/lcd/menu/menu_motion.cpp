@@ -325,6 +325,14 @@ void menu_move() {
     ui.go_back();
   }
 
+  #if HAS_X_AXIS
+    void _ftm_refresh_shaping_n() {
+      fxdTiCtrl.holdTask(true);
+      fxdTiCtrl.refreshShapingN();
+      fxdTiCtrl.holdTask(false);
+    }
+  #endif
+
   inline void menu_ftm_mode() {
     const ftMotionMode_t mode = fxdTiCtrl.cfg.mode;
 
@@ -410,10 +418,10 @@ void menu_move() {
     MENU_ITEM_ADDON_START_RJ(5); lcd_put_u8str(ftmode); MENU_ITEM_ADDON_END();
 
     #if HAS_X_AXIS
-      EDIT_ITEM_FAST_N(float42_52, X_AXIS, MSG_FTM_BASE_FREQ_N, &c.baseFreq[X_AXIS], FTM_MIN_SHAPE_FREQ, (FTM_FS) / 2, fxdTiCtrl.refreshShapingN);
+      EDIT_ITEM_FAST_N(float42_52, X_AXIS, MSG_FTM_BASE_FREQ_N, &c.baseFreq[X_AXIS], FTM_MIN_SHAPE_FREQ, (FTM_FS) / 2, _ftm_refresh_shaping_n);
     #endif
     #if HAS_Y_AXIS
-      EDIT_ITEM_FAST_N(float42_52, Y_AXIS, MSG_FTM_BASE_FREQ_N, &c.baseFreq[Y_AXIS], FTM_MIN_SHAPE_FREQ, (FTM_FS) / 2, fxdTiCtrl.refreshShapingN);
+      EDIT_ITEM_FAST_N(float42_52, Y_AXIS, MSG_FTM_BASE_FREQ_N, &c.baseFreq[Y_AXIS], FTM_MIN_SHAPE_FREQ, (FTM_FS) / 2, _ftm_refresh_shaping_n);
     #endif
 
     #if HAS_DYNAMIC_FREQ
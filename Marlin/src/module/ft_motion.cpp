@@ -51,13 +51,15 @@ FxdTiCtrl fxdTiCtrl;
 // Public variables.
 
 ft_config_t FxdTiCtrl::cfg;
-ft_command_t FxdTiCtrl::stepperCmdBuff[FTM_STEPPERCMD_BUFF_SIZE] = {0U};                // Buffer of stepper commands.
-hal_timer_t FxdTiCtrl::stepperCmdBuff_StepRelativeTi[FTM_STEPPERCMD_BUFF_SIZE] = {0U};  // Buffer of the stepper command timing.
-uint8_t FxdTiCtrl::stepperCmdBuff_ApplyDir[FTM_STEPPERCMD_DIR_SIZE] = {0U};             // Buffer of whether DIR needs to be updated.
+ft_packed_command_t FxdTiCtrl::stepperCmdBuff[FTM_STEPPERCMD_BUFF_SIZE] = {0U}; // Buffer of packed stepper commands.
 uint32_t FxdTiCtrl::stepperCmdBuff_produceIdx = 0,  // Index of next stepper command write to the buffer.
          FxdTiCtrl::stepperCmdBuff_consumeIdx = 0;  // Index of next stepper command read from the buffer.
 
 bool FxdTiCtrl::sts_stepperBusy = false;          // The stepper buffer has items and is in use.
+uint32_t FxdTiCtrl::underruns = 0;                // Times the stepper found the buffer empty with work pending.
+#if ENABLED(FTM_TIMER_TASK)
+  volatile bool FxdTiCtrl::taskHeld = false;      // The main loop is changing the controller state.
+#endif
 
 // Private variables.
 // NOTE: These are sized for Ulendo FBS use.
@@ -115,6 +117,11 @@ float FxdTiCtrl::accel_P,                       // Acceleration prime of block.
       FxdTiCtrl::s_1e,                          // Position after acceleration phase of block.
       FxdTiCtrl::s_2e;                          // Position after acceleration and coasting phase of block.
 
+#if ENABLED(FTM_SCURVE)
+  ft_scurve_phase_t FxdTiCtrl::accelPhase,      // S-curve of the acceleration phase of block.
+                    FxdTiCtrl::decelPhase;      // S-curve of the deceleration phase of block.
+#endif
+
 uint32_t FxdTiCtrl::N1,                         // Number of data points in the acceleration phase.
          FxdTiCtrl::N2,                         // Number of data points in the coasting phase.
          FxdTiCtrl::N3;                         // Number of data points in the deceleration phase.
@@ -146,18 +153,19 @@ uint32_t FxdTiCtrl::makeVector_idx = 0,                     // Index of fixed ti
 
 uint32_t FxdTiCtrl::interpIdx = 0,                    // Index of current data point being interpolated.
          FxdTiCtrl::interpIdx_z1 = 0;                 // Storage for the previously calculated index above.
-hal_timer_t FxdTiCtrl::nextStepTicks = FTM_MIN_TICKS; // Accumulator for the next step time (in ticks).
+uint8_t FxdTiCtrl::nextStepIntervals = 1;             // Accumulator for the next step time (in FTM_MIN_TICKS).
 
 // Shaping variables.
 #if HAS_X_AXIS
-  uint32_t FxdTiCtrl::xy_zi_idx = 0,                  // Index of storage in the data point delay vectors.
-           FxdTiCtrl::xy_max_i = 0;                   // Vector length for the selected shaper.
-  float FxdTiCtrl::xd_zi[FTM_ZMAX] = { 0.0f };        // Data point delay vector.
+  uint32_t FxdTiCtrl::xy_zi_idx = 0,                  // Index of the next data point after the history in the delay vectors.
+           FxdTiCtrl::xy_max_i = 0,                   // Vector length for the selected shaper.
+           FxdTiCtrl::shapeIdx = FTM_BATCH_SIZE;      // Index of the next data point to shape in the batch.
+  float FxdTiCtrl::xd_zi[(FTM_ZMAX) + (FTM_BATCH_SIZE)] = { 0.0f }; // Data point delay vector.
   float FxdTiCtrl::x_Ai[5];                           // Shaping gain vector.
   uint32_t FxdTiCtrl::x_Ni[5];                        // Shaping time index vector.
 #endif
 #if HAS_Y_AXIS
-  float FxdTiCtrl::yd_zi[FTM_ZMAX] = { 0.0f };
+  float FxdTiCtrl::yd_zi[(FTM_ZMAX) + (FTM_BATCH_SIZE)] = { 0.0f };
   float FxdTiCtrl::y_Ai[5];
   uint32_t FxdTiCtrl::y_Ni[5];
 #endif
@@ -187,6 +195,8 @@ void FxdTiCtrl::runoutBlock() {
 
   if (runoutEna && !batchRdy) {   // If the window is full already (block intervals was a multiple of
                                   // the batch size), or runout is not enabled, no runout is needed.
+    TERN_(HAS_X_AXIS, shapeTo(makeVector_batchIdx)); // Shape the points so far before repeating the last one.
+
     // Fill out the trajectory window with the last position calculated.
     if (makeVector_batchIdx > FTM_BATCH_SIZE) {
       for (uint32_t i = makeVector_batchIdx; i < 2 * (FTM_BATCH_SIZE); i++) {
@@ -197,12 +207,30 @@ void FxdTiCtrl::runoutBlock() {
       }
     }
     makeVector_batchIdx = FTM_BATCH_SIZE;
+    TERN_(HAS_X_AXIS, shapeIdx = FTM_BATCH_SIZE);
     batchRdy = true;
   }
   runoutEna = false;
 }
 
-// Controller main, to be invoked from non-isr task.
+// True if the producer has a block or points still to output. The stepper ISR
+// counts an underrun if it empties the buffer while this is true.
+bool FxdTiCtrl::producerPending() {
+  return (blockProcRdy && !blockProcDn) || batchRdy || batchRdyForInterp || planner.has_blocks_queued();
+}
+
+// With FTM_TIMER_TASK each temperature ISR call only makes a few periods of trajectory points
+// and their stepper commands, three times what the stepper uses, to keep the ISR call short.
+#if ENABLED(FTM_TIMER_TASK)
+  constexpr uint32_t task_points = 3 * (((FTM_FS) + (TEMP_TIMER_FREQUENCY) - 1) / (TEMP_TIMER_FREQUENCY)),
+                     points_per_loop = _MIN(FTM_POINTS_PER_LOOP, task_points),
+                     steps_per_loop = _MIN(FTM_STEPS_PER_LOOP, task_points);
+#else
+  constexpr uint32_t points_per_loop = FTM_POINTS_PER_LOOP,
+                     steps_per_loop = FTM_STEPS_PER_LOOP;
+#endif
+
+// Controller main, to be invoked from idle() or, with FTM_TIMER_TASK, the temperature ISR.
 void FxdTiCtrl::loop() {
 
   if (!cfg.mode) return;
@@ -225,7 +253,7 @@ void FxdTiCtrl::loop() {
 
   if (blockProcRdy) {
     if (!blockProcRdy_z1) loadBlockData(current_block_cpy); // One-shot.
-    while (!blockProcDn && !batchRdy && (makeVector_idx - makeVector_idx_z1 < (FTM_POINTS_PER_LOOP)))
+    while (!blockProcDn && !batchRdy && (makeVector_idx - makeVector_idx_z1 < points_per_loop))
       makeVector();
   }
 
@@ -260,7 +288,7 @@ void FxdTiCtrl::loop() {
   // Interpolation.
   while ( batchRdyForInterp
           && ( stepperCmdBuffItems() < ((FTM_STEPPERCMD_BUFF_SIZE) - (FTM_STEPS_PER_UNIT_TIME)) )
-          && ( (interpIdx - interpIdx_z1) < (FTM_STEPS_PER_LOOP) )
+          && ( (interpIdx - interpIdx_z1) < steps_per_loop )
   ) {
     convertToSteps(interpIdx);
 
@@ -448,11 +476,12 @@ void FxdTiCtrl::reset() {
   TERN_(HAS_Z_AXIS,    z_dirState = stepDirState_NOT_SET);
   TERN_(HAS_EXTRUDERS, e_dirState = stepDirState_NOT_SET);
 
-  nextStepTicks = FTM_MIN_TICKS;
+  nextStepIntervals = 1;
 
   #if HAS_X_AXIS
-    for (uint32_t i = 0U; i < (FTM_ZMAX); i++) { xd_zi[i] = 0.0f; TERN_(HAS_Y_AXIS, yd_zi[i] = 0.0f); }
+    for (uint32_t i = 0U; i < (FTM_ZMAX) + (FTM_BATCH_SIZE); i++) { xd_zi[i] = 0.0f; TERN_(HAS_Y_AXIS, yd_zi[i] = 0.0f); }
     xy_zi_idx = 0;
+    shapeIdx = FTM_BATCH_SIZE;
   #endif
 
   TERN_(HAS_EXTRUDERS, e_raw_z1 = e_advanced_z1 = 0.0f);
@@ -466,14 +495,53 @@ uint32_t FxdTiCtrl::stepperCmdBuffItems() {
 }
 
 // Initializes storage variables before startup.
+// The temperature ISR is already running by now, so hold the task.
 void FxdTiCtrl::init() {
+  holdTask(true);
   #if HAS_X_AXIS
     refreshShapingN();
     updateShapingA();
   #endif
   reset(); // Precautionary.
+  holdTask(false);
 }
 
+#if ENABLED(FTM_SCURVE)
+
+  /**
+   * Set up an S-curve phase from speed v0 to v1 over T seconds. The acceleration ramps up,
+   * holds, and ramps down, taking the same time and distance as a constant acceleration,
+   * so the block keeps the planner's junction speeds and timing. The ramps are as short as
+   * 'jmax' (mm/s^3) allows. If the phase is too short for that, it's a pure S.
+   */
+  static void sCurvePhase(ft_scurve_phase_t &p, const_float_t v0, const_float_t v1, const_float_t T, const_float_t jmax) {
+    const float dv = v1 - v0, disc = sq(T) - 4.0f * ABS(dv) / jmax;
+    p.v0 = v0;
+    p.v1 = v1;
+    p.T = T;
+    p.Tj = (T <= 0.0f || dv == 0.0f) ? 0.0f : disc > 0.0f ? 0.5f * (T - SQRT(disc)) : 0.5f * T;
+    p.A = T > 0.0f ? dv / (T - p.Tj) : 0.0f;
+    p.J = p.Tj > 0.0f ? p.A / p.Tj : 0.0f;
+  }
+
+  // Distance covered 't' seconds into an S-curve phase. Also get the acceleration at 't'.
+  static float sCurveDist(const ft_scurve_phase_t &p, const_float_t t, float &accel) {
+    if (t < p.Tj) {                       // Jerk up
+      accel = p.J * t;
+      return t * (p.v0 + p.J * sq(t) / 6.0f);
+    }
+    const float u = p.T - t;              // Time left in the phase
+    if (u < p.Tj) {                       // Jerk down, mirroring the jerk up
+      accel = p.J * u;
+      return 0.5f * (p.v0 + p.v1) * p.T - u * (p.v1 - p.J * sq(u) / 6.0f);
+    }
+    const float tau = t - p.Tj;           // Constant acceleration
+    accel = p.A;
+    return p.Tj * (p.v0 + p.A * p.Tj / 6.0f) + tau * (p.v0 + 0.5f * p.A * (p.Tj + tau));
+  }
+
+#endif // FTM_SCURVE
+
 // Loads / converts block data from planner to fixed-time control variables.
 void FxdTiCtrl::loadBlockData(block_t * const current_block) {
 
@@ -564,6 +632,19 @@ void FxdTiCtrl::loadBlockData(block_t * const current_block) {
   // Calculate the distance traveled during the decel phase
   s_2e = s_1e + F_P * T2_P;
 
+  #if ENABLED(FTM_SCURVE)
+    // The path jerk that keeps each axis within its limit
+    static constexpr float max_jerk[] = FTM_MAX_JERK;
+    float jmax = 1e10f;
+    TERN_(HAS_X_AXIS,    if (x_Ratio) NOMORE(jmax, max_jerk[X_AXIS] / ABS(x_Ratio)));
+    TERN_(HAS_Y_AXIS,    if (y_Ratio) NOMORE(jmax, max_jerk[Y_AXIS] / ABS(y_Ratio)));
+    TERN_(HAS_Z_AXIS,    if (z_Ratio) NOMORE(jmax, max_jerk[Z_AXIS] / ABS(z_Ratio)));
+    TERN_(HAS_EXTRUDERS, if (e_Ratio) NOMORE(jmax, max_jerk[E_AXIS] / ABS(e_Ratio)));
+
+    sCurvePhase(accelPhase, f_s, F_P, T1_P, jmax);
+    sCurvePhase(decelPhase, F_P, f_e, T3_P, jmax);
+  #endif
+
   // One less than (Accel + Coasting + Decel) datapoints
   max_intervals = N1 + N2 + N3 - 1U;
 
@@ -581,8 +662,12 @@ void FxdTiCtrl::makeVector() {
 
   if (makeVector_idx < N1) {
     // Acceleration phase
-    dist = (f_s * tau) + (0.5f * accel_P * sq(tau));      // (mm) Distance traveled for acceleration phase
-    accel_k = accel_P;                                    // (mm/s^2) Acceleration K factor from Accel phase
+    #if ENABLED(FTM_SCURVE)
+      dist = sCurveDist(accelPhase, tau, accel_k);
+    #else
+      dist = (f_s * tau) + (0.5f * accel_P * sq(tau));    // (mm) Distance traveled for acceleration phase
+      accel_k = accel_P;                                  // (mm/s^2) Acceleration K factor from Accel phase
+    #endif
   }
   else if (makeVector_idx >= N1 && makeVector_idx < (N1 + N2)) {
     // Coasting phase
@@ -592,8 +677,12 @@ void FxdTiCtrl::makeVector() {
   else {
     // Deceleration phase
     const float tau_ = tau - (N1 + N2) * (FTM_TS);        // (s) Time since start of decel phase
-    dist = s_2e + F_P * tau_ + 0.5f * decel_P * sq(tau_); // (mm) Distance traveled for deceleration phase
-    accel_k = decel_P;                                    // (mm/s^2) Acceleration K factor from Decel phase
+    #if ENABLED(FTM_SCURVE)
+      dist = s_2e + sCurveDist(decelPhase, tau_, accel_k);
+    #else
+      dist = s_2e + F_P * tau_ + 0.5f * decel_P * sq(tau_); // (mm) Distance traveled for deceleration phase
+      accel_k = decel_P;                                  // (mm/s^2) Acceleration K factor from Decel phase
+    #endif
   }
 
   TERN_(HAS_X_AXIS, xd[makeVector_batchIdx] = x_startPosn + x_Ratio * dist);  // (mm) X position for this datapoint
@@ -646,29 +735,19 @@ void FxdTiCtrl::makeVector() {
     default: break;
   }
 
-  // Apply shaping if in mode.
+  // Apply shaping if in mode. A dynamic frequency changes the shaper from one point
+  // to the next, so shape each point as it's made. So does the temperature ISR task,
+  // to spread the work over its calls. Otherwise shape the whole batch.
   #if HAS_X_AXIS
-    if (WITHIN(cfg.mode, 10U, 19U)) {
-      xd_zi[xy_zi_idx] = xd[makeVector_batchIdx];
-      xd[makeVector_batchIdx] *= x_Ai[0];
-      #if HAS_Y_AXIS
-        yd_zi[xy_zi_idx] = yd[makeVector_batchIdx];
-        yd[makeVector_batchIdx] *= y_Ai[0];
-      #endif
-      for (uint32_t i = 1U; i <= xy_max_i; i++) {
-        const uint32_t udiffx = xy_zi_idx - x_Ni[i];
-        xd[makeVector_batchIdx] += x_Ai[i] * xd_zi[x_Ni[i] > xy_zi_idx ? (FTM_ZMAX) + udiffx : udiffx];
-        #if HAS_Y_AXIS
-          const uint32_t udiffy = xy_zi_idx - y_Ni[i];
-          yd[makeVector_batchIdx] += y_Ai[i] * yd_zi[y_Ni[i] > xy_zi_idx ? (FTM_ZMAX) + udiffy : udiffy];
-        #endif
-      }
-      if (++xy_zi_idx == (FTM_ZMAX)) xy_zi_idx = 0;
-    }
+    if (ENABLED(FTM_TIMER_TASK) || cfg.dynFreqMode != dynFreqMode_DISABLED) shapeTo(makeVector_batchIdx + 1);
   #endif
 
   // Filled up the queue with regular and shaped steps
   if (++makeVector_batchIdx == 2 * (FTM_BATCH_SIZE)) {
+    #if HAS_X_AXIS
+      shapeTo(makeVector_batchIdx);
+      shapeIdx = FTM_BATCH_SIZE;
+    #endif
     makeVector_batchIdx = FTM_BATCH_SIZE;
     batchRdy = true;
   }
@@ -682,6 +761,51 @@ void FxdTiCtrl::makeVector() {
     makeVector_idx++;
 }
 
+#if HAS_X_AXIS
+
+  /**
+   * Shape a run of data points of one axis in place. The unshaped points are appended to
+   * the history, so each delayed term reads a contiguous run of it and is applied to all
+   * the points in one loop, which the compiler may vectorize. Each point still gets its
+   * terms added in the same order, so the result doesn't depend on the run length.
+   */
+  static void __O3 shapeRun(float * const __restrict__ d, const uint32_t count, float * const __restrict__ zi,
+                       const float * const Ai, const uint32_t * const Ni, const uint32_t max_i
+  ) {
+    for (uint32_t j = 0U; j < count; j++) { zi[j] = d[j]; d[j] *= Ai[0]; }
+    for (uint32_t i = 1U; i <= max_i; i++) {
+      const float A = Ai[i];
+      const float * const z = zi - Ni[i];
+      for (uint32_t j = 0U; j < count; j++) d[j] += A * z[j];
+    }
+  }
+
+  // Shape the data points from idx. The last FTM_ZMAX unshaped points come before
+  // xy_zi_idx in the delay vectors, which are shifted down once they fill up.
+  void FxdTiCtrl::shapeSamples(uint32_t idx, uint32_t count) {
+    while (count) {
+      const uint32_t run = _MIN(count, (FTM_BATCH_SIZE) - xy_zi_idx);
+      shapeRun(&xd[idx], run, &xd_zi[(FTM_ZMAX) + xy_zi_idx], x_Ai, x_Ni, xy_max_i);
+      TERN_(HAS_Y_AXIS, shapeRun(&yd[idx], run, &yd_zi[(FTM_ZMAX) + xy_zi_idx], y_Ai, y_Ni, xy_max_i));
+      idx += run;
+      count -= run;
+      xy_zi_idx += run;
+      if (xy_zi_idx == (FTM_BATCH_SIZE)) {
+        memmove(xd_zi, &xd_zi[FTM_BATCH_SIZE], (FTM_ZMAX) * sizeof(float));
+        TERN_(HAS_Y_AXIS, memmove(yd_zi, &yd_zi[FTM_BATCH_SIZE], (FTM_ZMAX) * sizeof(float)));
+        xy_zi_idx = 0;
+      }
+    }
+  }
+
+  // Shape the data points of the batch up to 'end', if in a shaping mode.
+  void FxdTiCtrl::shapeTo(const uint32_t end) {
+    if (cfg.modeHasShaper() && end > shapeIdx) shapeSamples(shapeIdx, end - shapeIdx);
+    shapeIdx = end;
+  }
+
+#endif // HAS_X_AXIS
+
 // Interpolates single data point to stepper commands.
 void FxdTiCtrl::convertToSteps(const uint32_t idx) {
   #if HAS_X_AXIS
@@ -745,7 +869,7 @@ void FxdTiCtrl::convertToSteps(const uint32_t idx) {
 
     bool anyStep = false;
 
-    stepperCmdBuff[stepperCmdBuff_produceIdx] = 0;
+    ft_command_t command = 0;
 
     // Commands are written in the format:
     // |X_step|X_direction|Y_step|Y_direction|Z_step|Z_direction|E_step|E_direction|
@@ -756,7 +880,7 @@ void FxdTiCtrl::convertToSteps(const uint32_t idx) {
         }
         else {
           x_steps++;
-          stepperCmdBuff[stepperCmdBuff_produceIdx] |= _BV(FT_BIT_DIR_X) | _BV(FT_BIT_STEP_X);
+          command |= _BV(FT_BIT_DIR_X) | _BV(FT_BIT_STEP_X);
           x_err_P += x_delta - (FTM_STEPS_PER_UNIT_TIME);
           anyStep = true;
         }
@@ -767,7 +891,7 @@ void FxdTiCtrl::convertToSteps(const uint32_t idx) {
         }
         else {
           x_steps--;
-          stepperCmdBuff[stepperCmdBuff_produceIdx] |= _BV(FT_BIT_STEP_X);
+          command |= _BV(FT_BIT_STEP_X);
           x_err_P += x_delta + (FTM_STEPS_PER_UNIT_TIME);
           anyStep = true;
         }
@@ -781,7 +905,7 @@ void FxdTiCtrl::convertToSteps(const uint32_t idx) {
         }
         else {
           y_steps++;
-          stepperCmdBuff[stepperCmdBuff_produceIdx] |= _BV(FT_BIT_DIR_Y) | _BV(FT_BIT_STEP_Y);
+          command |= _BV(FT_BIT_DIR_Y) | _BV(FT_BIT_STEP_Y);
           y_err_P += y_delta - (FTM_STEPS_PER_UNIT_TIME);
           anyStep = true;
         }
@@ -792,7 +916,7 @@ void FxdTiCtrl::convertToSteps(const uint32_t idx) {
         }
         else {
           y_steps--;
-          stepperCmdBuff[stepperCmdBuff_produceIdx] |= _BV(FT_BIT_STEP_Y);
+          command |= _BV(FT_BIT_STEP_Y);
           y_err_P += y_delta + (FTM_STEPS_PER_UNIT_TIME);
           anyStep = true;
         }
@@ -806,7 +930,7 @@ void FxdTiCtrl::convertToSteps(const uint32_t idx) {
         }
         else {
           z_steps++;
-          stepperCmdBuff[stepperCmdBuff_produceIdx] |= _BV(FT_BIT_DIR_Z) | _BV(FT_BIT_STEP_Z);
+          command |= _BV(FT_BIT_DIR_Z) | _BV(FT_BIT_STEP_Z);
           z_err_P += z_delta - (FTM_STEPS_PER_UNIT_TIME);
           anyStep = true;
         }
@@ -817,7 +941,7 @@ void FxdTiCtrl::convertToSteps(const uint32_t idx) {
         }
         else {
           z_steps--;
-          stepperCmdBuff[stepperCmdBuff_produceIdx] |= _BV(FT_BIT_STEP_Z);
+          command |= _BV(FT_BIT_STEP_Z);
           z_err_P += z_delta + (FTM_STEPS_PER_UNIT_TIME);
           anyStep = true;
         }
@@ -831,7 +955,7 @@ void FxdTiCtrl::convertToSteps(const uint32_t idx) {
         }
         else {
           e_steps++;
-          stepperCmdBuff[stepperCmdBuff_produceIdx] |= _BV(FT_BIT_DIR_E) | _BV(FT_BIT_STEP_E);
+          command |= _BV(FT_BIT_DIR_E) | _BV(FT_BIT_STEP_E);
           e_err_P += e_delta - (FTM_STEPS_PER_UNIT_TIME);
           anyStep = true;
         }
@@ -842,7 +966,7 @@ void FxdTiCtrl::convertToSteps(const uint32_t idx) {
         }
         else {
           e_steps--;
-          stepperCmdBuff[stepperCmdBuff_produceIdx] |= _BV(FT_BIT_STEP_E);
+          command |= _BV(FT_BIT_STEP_E);
           e_err_P += e_delta + (FTM_STEPS_PER_UNIT_TIME);
           anyStep = true;
         }
@@ -850,18 +974,19 @@ void FxdTiCtrl::convertToSteps(const uint32_t idx) {
     #endif // HAS_EXTRUDERS
 
     if (!anyStep) {
-      nextStepTicks += (FTM_MIN_TICKS);
+      // Wait out the time so far if one more interval won't fit in a command
+      if (nextStepIntervals == FT_MAX_INTERVALS) {
+        pushCommand(0, false, nextStepIntervals);
+        nextStepIntervals = 0;
+      }
+      nextStepIntervals++;
     }
     else {
-      stepperCmdBuff_StepRelativeTi[stepperCmdBuff_produceIdx] = nextStepTicks;
-
-      const uint8_t dir_index = stepperCmdBuff_produceIdx >> 3,
-                    dir_bit = stepperCmdBuff_produceIdx & 0x7;
+      const bool applyDir = any_dirChange;
       if (any_dirChange) {
-        SBI(stepperCmdBuff_ApplyDir[dir_index], dir_bit);
         #if HAS_X_AXIS
           if (x_delta > 0) {
-            stepperCmdBuff[stepperCmdBuff_produceIdx] |= _BV(FT_BIT_DIR_X);
+            command |= _BV(FT_BIT_DIR_X);
             x_dirState = stepDirState_POS;
           }
           else {
@@ -871,7 +996,7 @@ void FxdTiCtrl::convertToSteps(const uint32_t idx) {
 
         #if HAS_Y_AXIS
           if (y_delta > 0) {
-            stepperCmdBuff[stepperCmdBuff_produceIdx] |= _BV(FT_BIT_DIR_Y);
+            command |= _BV(FT_BIT_DIR_Y);
             y_dirState = stepDirState_POS;
           }
           else {
@@ -881,7 +1006,7 @@ void FxdTiCtrl::convertToSteps(const uint32_t idx) {
 
         #if HAS_Z_AXIS
           if (z_delta > 0) {
-            stepperCmdBuff[stepperCmdBuff_produceIdx] |= _BV(FT_BIT_DIR_Z);
+            command |= _BV(FT_BIT_DIR_Z);
             z_dirState = stepDirState_POS;
           }
           else {
@@ -891,7 +1016,7 @@ void FxdTiCtrl::convertToSteps(const uint32_t idx) {
 
         #if HAS_EXTRUDERS
           if (e_delta > 0) {
-            stepperCmdBuff[stepperCmdBuff_produceIdx] |= _BV(FT_BIT_DIR_E);
+            command |= _BV(FT_BIT_DIR_E);
             e_dirState = stepDirState_POS;
           }
           else {
@@ -901,20 +1026,207 @@ void FxdTiCtrl::convertToSteps(const uint32_t idx) {
 
         any_dirChange = false;
       }
-      else { // ...no direction change.
-        CBI(stepperCmdBuff_ApplyDir[dir_index], dir_bit);
+
+      pushCommand(command, applyDir, nextStepIntervals);
+      nextStepIntervals = 1;
+    }
+  } // FTM_STEPS_PER_UNIT_TIME loop
+}
+
+// Packs a stepper command into the buffer.
+void FxdTiCtrl::pushCommand(const ft_command_t command, const bool applyDir, const uint8_t intervals) {
+  stepperCmdBuff[stepperCmdBuff_produceIdx] = command
+    | (applyDir ? _BV(FT_BIT_APPLY_DIR) : 0)
+    | ft_packed_command_t(intervals) << (FT_INTERVALS_SHIFT);
+
+  // Advance the index in one write, since the stepper ISR reads it.
+  stepperCmdBuff_produceIdx = stepperCmdBuff_produceIdx < (FTM_STEPPERCMD_BUFF_SIZE) - 1 ? stepperCmdBuff_produceIdx + 1 : 0;
+}
+
+#if ENABLED(MARLIN_TEST_BUILD) && HAS_X_AXIS
+
+  #include "../tests/marlin_tests.h"
+
+  /**
+   * Shape a synthetic trajectory with each shaper, in whole batches and in uneven runs, and
+   * compare both with the point-by-point ring buffer convolution bit for bit. Then time the
+   * batched and the ring buffer shaping. The points per ms show the headroom for FTM_FS.
+   */
+  void FxdTiCtrl::test_shaping() {
+    constexpr uint16_t batches = 100, timed_batches = 1000;
+    constexpr float freq = 40.0f; // (Hz) Delays within FTM_ZMAX for every shaper
+    static const struct { ftMotionMode_t mode; const char *name; } shapers[] = {
+      { ftMotionMode_ZV, "ZV" }, { ftMotionMode_ZVD, "ZVD" }, { ftMotionMode_MZV, "MZV" },
+      { ftMotionMode_EI, "EI" }, { ftMotionMode_2HEI, "2HEI" }, { ftMotionMode_3HEI, "3HEI" }
+    };
+
+    // A smooth move with a sawtooth on it
+    auto fill = [](const uint16_t b) {
+      for (uint32_t j = 0U; j < (FTM_BATCH_SIZE); j++) {
+        const uint32_t n = b * (FTM_BATCH_SIZE) + j;
+        xd[(FTM_BATCH_SIZE) + j] = 50.0f + 40.0f * sinf(n * 0.013f) + 0.7f * (n % 37);
+        TERN_(HAS_Y_AXIS, yd[(FTM_BATCH_SIZE) + j] = 20.0f + 0.01f * n + 0.3f * (n % 23));
       }
+    };
 
-      if (stepperCmdBuff_produceIdx == (FTM_STEPPERCMD_BUFF_SIZE) - 1) {
-        stepperCmdBuff_produceIdx = 0;
+    // Reference: the shaping as it was done for each point, with a ring buffer of inputs
+    static float x_ring[FTM_ZMAX], x_ref[FTM_BATCH_SIZE];
+    #if HAS_Y_AXIS
+      static float y_ring[FTM_ZMAX], y_ref[FTM_BATCH_SIZE];
+    #endif
+    uint32_t ring_idx = 0;
+    auto reference = [&ring_idx]{
+      for (uint32_t j = 0U; j < (FTM_BATCH_SIZE); j++) {
+        x_ring[ring_idx] = xd[(FTM_BATCH_SIZE) + j];
+        x_ref[j] = xd[(FTM_BATCH_SIZE) + j] * x_Ai[0];
+        #if HAS_Y_AXIS
+          y_ring[ring_idx] = yd[(FTM_BATCH_SIZE) + j];
+          y_ref[j] = yd[(FTM_BATCH_SIZE) + j] * y_Ai[0];
+        #endif
+        for (uint32_t i = 1U; i <= xy_max_i; i++) {
+          const uint32_t udiffx = ring_idx - x_Ni[i];
+          x_ref[j] += x_Ai[i] * x_ring[x_Ni[i] > ring_idx ? (FTM_ZMAX) + udiffx : udiffx];
+          #if HAS_Y_AXIS
+            const uint32_t udiffy = ring_idx - y_Ni[i];
+            y_ref[j] += y_Ai[i] * y_ring[y_Ni[i] > ring_idx ? (FTM_ZMAX) + udiffy : udiffy];
+          #endif
+        }
+        if (++ring_idx == (FTM_ZMAX)) ring_idx = 0;
       }
-      else {
-        stepperCmdBuff_produceIdx++;
+    };
+    auto restart = [&ring_idx]{
+      reset();
+      for (uint32_t i = 0U; i < (FTM_ZMAX); i++) { x_ring[i] = 0.0f; TERN_(HAS_Y_AXIS, y_ring[i] = 0.0f); }
+      ring_idx = 0;
+    };
+
+    const ftMotionMode_t old_mode = cfg.mode;
+    for (const auto &shaper : shapers) {
+      cfg.mode = shaper.mode;
+      updateShapingA();
+      updateShapingN(freq OPTARG(HAS_Y_AXIS, freq));
+
+      uint16_t failures = 0;
+      for (uint8_t uneven = 0; uneven < 2; uneven++) {
+        restart();
+        for (uint16_t b = 0; b < batches; b++) {
+          fill(b);
+          reference();
+          if (uneven) // Runs of 1 to 13 points, some across the shift of the delay vectors
+            for (uint32_t j = 0U, run; j < (FTM_BATCH_SIZE); j += run) {
+              run = _MIN(1U + (b + j) % 13U, (FTM_BATCH_SIZE) - j);
+              shapeSamples((FTM_BATCH_SIZE) + j, run);
+            }
+          else
+            shapeSamples(FTM_BATCH_SIZE, FTM_BATCH_SIZE);
+          const bool mismatch = memcmp(&xd[FTM_BATCH_SIZE], x_ref, sizeof(x_ref))
+                             || TERN0(HAS_Y_AXIS, memcmp(&yd[FTM_BATCH_SIZE], y_ref, sizeof(y_ref)));
+          if (mismatch && ++failures <= 5)
+            SERIAL_ECHOLNPGM("FT shaping mismatch: ", shaper.name, " batch ", b, uneven ? " (uneven runs)" : "");
+        }
       }
 
-      nextStepTicks = FTM_MIN_TICKS;
+      // Speed, refilling each batch with the first one in both timings
+      fill(0);
+      static float x_first[FTM_BATCH_SIZE];
+      memcpy(x_first, &xd[FTM_BATCH_SIZE], sizeof(x_first));
+      #if HAS_Y_AXIS
+        static float y_first[FTM_BATCH_SIZE];
+        memcpy(y_first, &yd[FTM_BATCH_SIZE], sizeof(y_first));
+      #endif
+      auto refill = []{
+        memcpy(&xd[FTM_BATCH_SIZE], x_first, sizeof(x_first));
+        TERN_(HAS_Y_AXIS, memcpy(&yd[FTM_BATCH_SIZE], y_first, sizeof(y_first)));
+      };
+
+      restart();
+      uint32_t t = testMicros();
+      for (uint16_t b = 0; b < timed_batches; b++) { refill(); shapeSamples(FTM_BATCH_SIZE, FTM_BATCH_SIZE); }
+      const uint32_t batched_us = testMicros() - t;
+
+      restart();
+      t = testMicros();
+      for (uint16_t b = 0; b < timed_batches; b++) { refill(); reference(); }
+      const uint32_t reference_us = testMicros() - t;
+
+      constexpr uint32_t points = uint32_t(timed_batches) * (FTM_BATCH_SIZE);
+      countTestFailures(failures);
+      SERIAL_ECHOLNPGM("FT shaping ", shaper.name, ": ", failures, " mismatches, ",
+        batched_us ? points * 1000UL / batched_us : 0UL, " points/ms (ring buffer ",
+        reference_us ? points * 1000UL / reference_us : 0UL, " points/ms)");
     }
-  } // FTM_STEPS_PER_UNIT_TIME loop
-}
+
+    cfg.mode = old_mode;
+    refreshShapingN();
+    updateShapingA();
+    reset();
+  }
+
+#endif // MARLIN_TEST_BUILD
+
+#if BOTH(MARLIN_TEST_BUILD, FTM_SCURVE)
+
+  #include "../tests/marlin_tests.h"
+
+  /**
+   * Check S-curve phases for the trapezoid's distance, speeds at both ends, and jerk limit.
+   * Then drive undamped resonances from 100 to 300Hz with each phase and compare the worst
+   * vibration left to that of the constant acceleration in the same time.
+   */
+  void FxdTiCtrl::test_scurve() {
+    static const struct { float v0, v1, T, jmax; } phases[] = {
+      {   0, 100, 0.0334f, 1e6f }, {  20, 150, 0.0437f, 1e6f }, { 150,  20, 0.0437f, 1e6f },
+      { 100,   0, 0.0334f, 5e4f }, {   5,   5, 0.0100f, 1e6f }, {   0,   5, 0.0613f, 1e4f }
+    };
+    constexpr float dt = 1e-5f;
+
+    // Worst vibration amplitude of resonances at rest after an acceleration profile
+    auto residual = [&](const ft_scurve_phase_t &p, const bool scurve) {
+      float worst = 0;
+      for (uint16_t f = 100; f <= 300; f += 10) {
+        const float w = RADIANS(360) * f;
+        float z = 0, dz = 0, a = (p.v1 - p.v0) / p.T;
+        for (float t = 0; t < p.T; t += dt) {
+          if (scurve) sCurveDist(p, t, a);
+          dz -= (sq(w) * z + a) * dt;
+          z += dz * dt;
+        }
+        NOLESS(worst, SQRT(sq(z) + sq(dz / w)));
+      }
+      return worst;
+    };
+
+    uint16_t failures = 0;
+    float worst = 0;
+    for (const auto &ph : phases) {
+      ft_scurve_phase_t p;
+      sCurvePhase(p, ph.v0, ph.v1, ph.T, ph.jmax);
+
+      // Distance at the end and speed (by difference) at both ends
+      float a;
+      const float h = 1e-4f,
+                  end = sCurveDist(p, p.T, a) - 0.5f * (ph.v0 + ph.v1) * ph.T,
+                  vs = sCurveDist(p, h, a) / h,
+                  ve = (sCurveDist(p, p.T, a) - sCurveDist(p, p.T - h, a)) / h;
+      const bool feasible = sq(ph.T) >= 4 * ABS(ph.v1 - ph.v0) / ph.jmax;
+      if (ABS(end) > 1e-4f || ABS(vs - ph.v0) > 0.05f || ABS(ve - ph.v1) > 0.05f || (feasible && ABS(p.J) > ph.jmax * 1.001f)) {
+        if (++failures <= 5) SERIAL_ECHOLNPGM("S-curve mismatch: ", ph.v0, " to ", ph.v1, " mm/s in ", ph.T, "s");
+        continue;
+      }
+
+      if (ph.v0 != ph.v1) {
+        const float ratio = residual(p, true) / residual(p, false);
+        NOLESS(worst, ratio);
+        if (ratio > 1) ++failures;
+      }
+    }
+
+    countTestFailures(failures);
+    SERIAL_ECHOPGM("FT S-curve: ", failures, " mismatches");
+    SERIAL_ECHOPAIR_F(", 100-300Hz vibration up to ", worst * 100, 1);
+    SERIAL_ECHOLNPGM("% of constant acceleration");
+  }
+
+#endif // MARLIN_TEST_BUILD && FTM_SCURVE
 
 #endif // FT_MOTION
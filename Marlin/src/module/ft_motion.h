@@ -26,8 +26,6 @@
 
 #include "ft_types.h"
 
-#define FTM_STEPPERCMD_DIR_SIZE ((FTM_STEPPERCMD_BUFF_SIZE + 7) / 8)
-
 #if HAS_X_AXIS && (HAS_Z_AXIS || HAS_EXTRUDERS)
   #define HAS_DYNAMIC_FREQ 1
   #if HAS_Z_AXIS
@@ -69,6 +67,8 @@ class FxdTiCtrl {
     static ft_config_t cfg;
 
     static void set_defaults() {
+      holdTask(true);
+
       cfg.mode = FTM_DEFAULT_MODE;
 
       TERN_(HAS_X_AXIS, cfg.baseFreq[X_AXIS] = FTM_SHAPING_DEFAULT_X_FREQ);
@@ -90,23 +90,48 @@ class FxdTiCtrl {
       #endif
 
       reset();
+
+      holdTask(false);
     }
 
-    static ft_command_t stepperCmdBuff[FTM_STEPPERCMD_BUFF_SIZE];               // Buffer of stepper commands.
-    static hal_timer_t stepperCmdBuff_StepRelativeTi[FTM_STEPPERCMD_BUFF_SIZE]; // Buffer of the stepper command timing.
-    static uint8_t stepperCmdBuff_ApplyDir[FTM_STEPPERCMD_DIR_SIZE];            // Buffer of whether DIR needs to be updated.
+    // The stepper command buffer is a single-producer, single-consumer ring. The producer (loop)
+    // only writes the commands and stepperCmdBuff_produceIdx. The consumer (Stepper::isr) only
+    // writes stepperCmdBuff_consumeIdx. Each index moves in a single write after its command is
+    // in place, so the stepper ISR can preempt the producer anywhere. The producer runs from
+    // idle() or, with FTM_TIMER_TASK, from the temperature ISR. reset() rewinds both indexes,
+    // so the main loop holds the task while it runs.
+    static ft_packed_command_t stepperCmdBuff[FTM_STEPPERCMD_BUFF_SIZE]; // Buffer of packed stepper commands.
     static uint32_t stepperCmdBuff_produceIdx,              // Index of next stepper command write to the buffer.
                     stepperCmdBuff_consumeIdx;              // Index of next stepper command read from the buffer.
 
     static bool sts_stepperBusy;                            // The stepper buffer has items and is in use.
+    static uint32_t underruns;                              // Times the stepper found the buffer empty with work pending.
 
+    #if ENABLED(FTM_TIMER_TASK)
+      static volatile bool taskHeld;                        // The main loop is changing the controller state.
+    #endif
 
     // Public methods
     static void init();
     static void startBlockProc(block_t * const current_block); // Set controller states to begin processing a block.
     static bool getBlockProcDn() { return blockProcDn; }    // Return true if the controller no longer needs the current block.
     static void runoutBlock();                              // Move any free data points to the stepper buffer even if a full batch isn't ready.
-    static void loop();                                     // Controller main, to be invoked from non-isr task.
+    static void loop();                                     // Controller main, to be invoked from idle() or the temperature ISR.
+    static bool producerPending();                          // True if the producer has a block or points still to output.
+
+    // Keep the producer out of the controller state while the main loop changes it.
+    // With FTM_TIMER_TASK the producer runs in the temperature ISR, which can't preempt
+    // a main loop that has set the hold, and which the main loop can't preempt.
+    // The barriers keep the compiler from moving state changes out of the hold.
+    static void holdTask(const bool hold) {
+      #if ENABLED(FTM_TIMER_TASK)
+        __asm__ __volatile__("" ::: "memory");
+        taskHeld = hold;
+        __asm__ __volatile__("" ::: "memory");
+      #else
+        UNUSED(hold);
+      #endif
+    }
 
 
     #if HAS_X_AXIS
@@ -124,6 +149,13 @@ class FxdTiCtrl {
 
     static void reset();                                    // Resets all states of the fixed time conversion to defaults.
 
+    #if ENABLED(MARLIN_TEST_BUILD) && HAS_X_AXIS
+      static void test_shaping();
+    #endif
+    #if BOTH(MARLIN_TEST_BUILD, FTM_SCURVE)
+      static void test_scurve();
+    #endif
+
   private:
 
     #if HAS_X_AXIS
@@ -163,6 +195,10 @@ class FxdTiCtrl {
                  s_1e,
                  s_2e;
 
+    #if ENABLED(FTM_SCURVE)
+      static ft_scurve_phase_t accelPhase, decelPhase;
+    #endif
+
     static uint32_t N1, N2, N3;
     static uint32_t max_intervals;
 
@@ -191,17 +227,17 @@ class FxdTiCtrl {
       static stepDirState_t e_dirState;
     #endif
 
-    static hal_timer_t nextStepTicks;
+    static uint8_t nextStepIntervals;
 
     // Shaping variables.
     #if HAS_X_AXIS
-      static uint32_t xy_zi_idx, xy_max_i;
-      static float xd_zi[FTM_ZMAX];
+      static uint32_t xy_zi_idx, xy_max_i, shapeIdx;
+      static float xd_zi[(FTM_ZMAX) + (FTM_BATCH_SIZE)];
       static float x_Ai[5];
       static uint32_t x_Ni[5];
     #endif
     #if HAS_Y_AXIS
-      static float yd_zi[FTM_ZMAX];
+      static float yd_zi[(FTM_ZMAX) + (FTM_BATCH_SIZE)];
       static float y_Ai[5];
       static uint32_t y_Ni[5];
     #endif
@@ -216,6 +252,11 @@ class FxdTiCtrl {
     static void loadBlockData(block_t * const current_block);
     static void makeVector();
     static void convertToSteps(const uint32_t idx);
+    #if HAS_X_AXIS
+      static void shapeTo(const uint32_t end);
+      static void shapeSamples(uint32_t idx, uint32_t count);
+    #endif
+    static void pushCommand(const ft_command_t command, const bool applyDir, const uint8_t intervals);
 
 }; // class fxdTiCtrl
 
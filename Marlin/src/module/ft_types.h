@@ -57,3 +57,23 @@ enum {
 };
 
 typedef bits_t(FT_BIT_COUNT) ft_command_t;
+
+/**
+ * A stepper command packed in one word:
+ * |Intervals (7 bits)|Apply DIR|X_step|X_direction|Y_step|Y_direction|Z_step|Z_direction|E_step|E_direction|
+ * Intervals is the time since the previous command, in units of FTM_MIN_TICKS.
+ * A command with no steps only waits, so idle time longer than one command can
+ * hold takes a run of waiting commands.
+ */
+typedef uint16_t ft_packed_command_t;
+
+#define FT_BIT_APPLY_DIR   FT_BIT_COUNT
+#define FT_INTERVALS_SHIFT (FT_BIT_COUNT + 1)
+#define FT_MAX_INTERVALS   ((1U << (16 - (FT_INTERVALS_SHIFT))) - 1)
+
+// One acceleration or deceleration phase of an S-curve profile
+typedef struct {
+  float v0, v1,   // (mm/s) Start and end speed
+        T, Tj,    // (s) Phase duration and duration of each jerk ramp
+        A, J;     // (mm/s^2, mm/s^3) Peak acceleration and jerk, negative to decelerate
+} ft_scurve_phase_t;
@@ -1381,6 +1381,13 @@ float get_move_distance(const xyze_pos_t &diff OPTARG(HAS_ROTATIONAL_AXES, bool
             return true;                                                             // all moves, including Z-only moves.
           #endif
         #elif ENABLED(SEGMENT_LEVELED_MOVES)
+          #if HAS_MESH_LINE_SPLIT && DISABLED(MESH_BICUBIC)
+            // Along X or Y the correction is straight within a cell. Only split between cells.
+            if (current_position.x == destination.x || current_position.y == destination.y) {
+              bedlevel.line_to_destination(scaled_fr_mm_s);
+              return true;
+            }
+          #endif
           segmented_line_to_destination(scaled_fr_mm_s);
           return false; // caller will update current_position
         #else
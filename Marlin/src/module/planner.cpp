@@ -118,6 +118,9 @@
 #define BLOCK_DELAY_NONE         0U
 #define BLOCK_DELAY_FOR_1ST_MOVE 100U
 
+// Entry and exit speed (squared) for blocks that start or end at a stop
+static constexpr speed_sqr_t min_planner_speed_sqr = speed_sqr_fixed(sq(float(MINIMUM_PLANNER_SPEED)));
+
 Planner planner;
 
 // public:
@@ -133,6 +136,11 @@ volatile uint8_t Planner::block_buffer_head,    // Index of the next block to be
 uint16_t Planner::cleaning_buffer_counter;      // A counter to disable queuing of blocks
 uint8_t Planner::delay_before_delivering;       // Delay block delivery so initial blocks in an empty queue may merge
 
+#if ENABLED(BUFFER_MONITORING)
+  uint32_t Planner::kernel_calls,               // Reverse and forward pass kernels run...
+           Planner::kernel_calls_skipped;       // ...and skipped due to a stable plan prefix
+#endif
+
 planner_settings_t Planner::settings;           // Initialized by settings.load()
 
 /**
@@ -776,9 +784,67 @@ block_t* Planner::get_current_block() {
   return nullptr;
 }
 
+#if ENABLED(PLANNER_FIXED_POINT)
+
+  // Integer square root, rounded up. Bitwise for 64-bit values...
+  static uint32_t isqrt_ceil(const uint64_t x) {
+    uint64_t rem = x, root = 0, bit = 1ULL << 62;
+    while (bit > x) bit >>= 2;
+    while (bit) {
+      if (rem >= root + bit) { rem -= root + bit; root = (root >> 1) + bit; }
+      else root >>= 1;
+      bit >>= 2;
+    }
+    return uint32_t(root) + (rem ? 1 : 0);
+  }
+
+  // ...and Newton's method for (more common) 32-bit values, using hardware division where available
+  static uint32_t isqrt_ceil(const uint32_t x) {
+    if (x < 2) return x;
+    uint32_t root = 2;
+    for (uint32_t t = x; t >= 4; t >>= 2) root <<= 1;     // >= sqrt(x)
+    for (;;) {
+      const uint32_t next = (root + x / root) >> 1;
+      if (next >= root) break;
+      root = next;
+    }
+    return root + (root * root < x ? 1 : 0);
+  }
+
+  // Step rate for a given speed-squared, using the block's conversion factor
+  FORCE_INLINE static uint32_t speed_sqr_to_rate(const block_t * const block, const speed_sqr_t speed_sqr) {
+    const uint64_t rate_sqr = (uint64_t(speed_sqr) * block->rate_sqr_factor) >> block->rate_sqr_shift;
+    return rate_sqr >> 32 ? isqrt_ceil(rate_sqr) : isqrt_ceil(uint32_t(rate_sqr));
+  }
+
+  // Steps needed to change rate^2 by 'delta' at the block's acceleration, rounded down or up
+  FORCE_INLINE static int32_t rate_sqr_to_steps(const block_t * const block, const int64_t delta, const bool round_up) {
+    const uint64_t n = uint64_t(ABS(delta)) * block->steps_factor,
+                   r = (round_up == (delta >= 0)) ? (1ULL << block->steps_shift) - 1 : 0;
+    const int32_t steps = (n + r) >> block->steps_shift;
+    return delta >= 0 ? steps : -steps;
+  }
+
+  // Pre-compute the terms used by the fixed-point kernels
+  static void fixed_point_block_setup(block_t * const block) {
+    block->accel_distance_sqr = speed_sqr_fixed(2 * block->acceleration * block->millimeters);
+
+    int exp;
+    float mantissa = frexpf(sq(block->nominal_rate / block->nominal_speed), &exp); // [0.5, 1) * 2^exp
+    block->rate_sqr_factor = uint32_t(_MIN(mantissa * 4294967296.0f, 4294967040.0f));
+    block->rate_sqr_shift = constrain(32 + (SPEED_SQR_FRACT) - exp, 0, 63);
+
+    mantissa = frexpf(0.5f / _MAX(block->acceleration_steps_per_s2, 1UL), &exp);
+    block->steps_factor = uint16_t(_MIN(mantissa * 65536.0f, 65535.0f));
+    block->steps_shift = constrain(16 - exp, 0, 62);
+  }
+
+#endif
+
 /**
  * Calculate trapezoid parameters, multiplying the entry- and exit-speeds
- * by the provided factors.
+ * by the provided factors. With PLANNER_FIXED_POINT the entry and exit
+ * speeds are given as fixed-point speed-squared values instead.
  **
  * ############ VERY IMPORTANT ############
  * NOTE that the PRECONDITION to call this function is that the block is
@@ -786,10 +852,17 @@ block_t* Planner::get_current_block() {
  * is not and will not use the block while we modify it, so it is safe to
  * alter its values.
  */
+#if ENABLED(PLANNER_FIXED_POINT)
+void Planner::calculate_trapezoid_for_block(block_t * const block, const speed_sqr_t entry_speed_sqr, const speed_sqr_t exit_speed_sqr) {
+
+  uint32_t initial_rate = speed_sqr_to_rate(block, entry_speed_sqr),
+           final_rate = speed_sqr_to_rate(block, exit_speed_sqr); // (steps per second)
+#else
 void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t entry_factor, const_float_t exit_factor) {
 
   uint32_t initial_rate = CEIL(block->nominal_rate * entry_factor),
            final_rate = CEIL(block->nominal_rate * exit_factor); // (steps per second)
+#endif
 
   // Limit minimal step rate (Otherwise the timer will overflow.)
   NOLESS(initial_rate, uint32_t(MINIMAL_STEP_RATE));
@@ -806,35 +879,71 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
            decelerate_steps = 0;
 
   const int32_t accel = block->acceleration_steps_per_s2;
-  float inverse_accel = 0.0f;
-  if (accel != 0) {
-    inverse_accel = 1.0f / accel;
-    const float half_inverse_accel = 0.5f * inverse_accel,
-                nominal_rate_sq = sq(float(block->nominal_rate)),
-                // Steps required for acceleration, deceleration to/from nominal rate
-                decelerate_steps_float = half_inverse_accel * (nominal_rate_sq - sq(float(final_rate)));
-          float accelerate_steps_float = half_inverse_accel * (nominal_rate_sq - sq(float(initial_rate)));
-    accelerate_steps = CEIL(accelerate_steps_float);
-    decelerate_steps = FLOOR(decelerate_steps_float);
-
-    // Steps between acceleration and deceleration, if any
-    plateau_steps -= accelerate_steps + decelerate_steps;
-
-    // Does accelerate_steps + decelerate_steps exceed step_event_count?
-    // Then we can't possibly reach the nominal rate, there will be no cruising.
-    // Calculate accel / braking time in order to reach the final_rate exactly
-    // at the end of this block.
-    if (plateau_steps < 0) {
-      accelerate_steps_float = CEIL((block->step_event_count + accelerate_steps_float - decelerate_steps_float) * 0.5f);
-      accelerate_steps = _MIN(uint32_t(_MAX(accelerate_steps_float, 0)), block->step_event_count);
-      decelerate_steps = block->step_event_count - accelerate_steps;
-
-      #if EITHER(S_CURVE_ACCELERATION, LIN_ADVANCE)
-        // We won't reach the cruising rate. Let's calculate the speed we will reach
-        cruise_rate = final_speed(initial_rate, accel, accelerate_steps);
-      #endif
+
+  #if ENABLED(PLANNER_FIXED_POINT)
+
+    #if ENABLED(S_CURVE_ACCELERATION)
+      const float inverse_accel = accel ? 1.0f / accel : 0.0f;
+    #endif
+
+    if (accel != 0) {
+      // Same math as below, in integer steps: steps = (rate2^2 - rate1^2) / (2 * accel)
+      const int64_t nominal_rate_sq = sq(int64_t(block->nominal_rate)),
+                    initial_rate_sq = sq(int64_t(initial_rate)),
+                    final_rate_sq = sq(int64_t(final_rate));
+
+      accelerate_steps = _MAX(rate_sqr_to_steps(block, nominal_rate_sq - initial_rate_sq, true), int32_t(0));
+      decelerate_steps = _MAX(rate_sqr_to_steps(block, nominal_rate_sq - final_rate_sq, false), int32_t(0));
+
+      // Steps between acceleration and deceleration, if any
+      plateau_steps -= accelerate_steps + decelerate_steps;
+
+      // No cruising. Accelerate until the point where braking reaches final_rate exactly.
+      if (plateau_steps < 0) {
+        const int32_t accel_steps = (int32_t(block->step_event_count) + rate_sqr_to_steps(block, final_rate_sq - initial_rate_sq, true) + 1) >> 1;
+        accelerate_steps = _MIN(uint32_t(_MAX(accel_steps, int32_t(0))), block->step_event_count);
+        decelerate_steps = block->step_event_count - accelerate_steps;
+
+        #if EITHER(S_CURVE_ACCELERATION, LIN_ADVANCE)
+          // We won't reach the cruising rate. Let's calculate the speed we will reach
+          cruise_rate = final_speed(initial_rate, accel, accelerate_steps);
+        #endif
+      }
     }
-  }
+
+  #else // !PLANNER_FIXED_POINT
+
+    float inverse_accel = 0.0f;
+    if (accel != 0) {
+      inverse_accel = 1.0f / accel;
+      const float half_inverse_accel = 0.5f * inverse_accel,
+                  nominal_rate_sq = sq(float(block->nominal_rate)),
+                  // Steps required for acceleration, deceleration to/from nominal rate
+                  decelerate_steps_float = half_inverse_accel * (nominal_rate_sq - sq(float(final_rate)));
+            float accelerate_steps_float = half_inverse_accel * (nominal_rate_sq - sq(float(initial_rate)));
+      accelerate_steps = CEIL(accelerate_steps_float);
+      decelerate_steps = FLOOR(decelerate_steps_float);
+
+      // Steps between acceleration and deceleration, if any
+      plateau_steps -= accelerate_steps + decelerate_steps;
+
+      // Does accelerate_steps + decelerate_steps exceed step_event_count?
+      // Then we can't possibly reach the nominal rate, there will be no cruising.
+      // Calculate accel / braking time in order to reach the final_rate exactly
+      // at the end of this block.
+      if (plateau_steps < 0) {
+        accelerate_steps_float = CEIL((block->step_event_count + accelerate_steps_float - decelerate_steps_float) * 0.5f);
+        accelerate_steps = _MIN(uint32_t(_MAX(accelerate_steps_float, 0)), block->step_event_count);
+        decelerate_steps = block->step_event_count - accelerate_steps;
+
+        #if EITHER(S_CURVE_ACCELERATION, LIN_ADVANCE)
+          // We won't reach the cruising rate. Let's calculate the speed we will reach
+          cruise_rate = final_speed(initial_rate, accel, accelerate_steps);
+        #endif
+      }
+    }
+
+  #endif // !PLANNER_FIXED_POINT
 
   #if ENABLED(S_CURVE_ACCELERATION)
     const float rate_factor = inverse_accel * (STEPPER_TIMER_RATE);
@@ -997,7 +1106,7 @@ void Planner::reverse_pass_kernel(block_t * const current, const block_t * const
     // in the next block, there is no need to recheck. Block is cruising and there is no need to
     // compute anything for this block,
     // If not, block entry speed needs to be recalculated to ensure maximum possible planned speed.
-    const float max_entry_speed_sqr = current->max_entry_speed_sqr;
+    const speed_sqr_t max_entry_speed_sqr = current->max_entry_speed_sqr;
 
     // Compute maximum entry speed decelerating over the current block from its exit speed.
     // If not at the maximum entry speed, or the previous block entry speed changed
@@ -1011,10 +1120,10 @@ void Planner::reverse_pass_kernel(block_t * const current, const block_t * const
       // the reverse and forward planners, the corresponding block junction speed will always be at the
       // the maximum junction speed and may always be ignored for any speed reduction checks.
 
-      const float next_entry_speed_sqr = next ? next->entry_speed_sqr : _MAX(TERN0(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr), sq(float(MINIMUM_PLANNER_SPEED))),
-                  new_entry_speed_sqr = current->flag.nominal_length
-                    ? max_entry_speed_sqr
-                    : _MIN(max_entry_speed_sqr, max_allowable_speed_sqr(-current->acceleration, next_entry_speed_sqr, current->millimeters));
+      const speed_sqr_t next_entry_speed_sqr = next ? next->entry_speed_sqr : _MAX(speed_sqr_fixed(TERN0(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr)), min_planner_speed_sqr),
+                        new_entry_speed_sqr = current->flag.nominal_length
+                          ? max_entry_speed_sqr
+                          : _MIN(max_entry_speed_sqr, accelerated_speed_sqr(current, next_entry_speed_sqr));
       if (current->entry_speed_sqr != new_entry_speed_sqr) {
 
         // Need to recalculate the block speed - Mark it now, so the stepper
@@ -1042,8 +1151,11 @@ void Planner::reverse_pass_kernel(block_t * const current, const block_t * const
 /**
  * recalculate() needs to go over the current plan twice.
  * Once in reverse and once forward. This implements the reverse pass.
+ *
+ * Returns the index of the first block of the changed part of the plan.
+ * Blocks before it form a stable prefix that the forward pass can skip.
  */
-void Planner::reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr)) {
+uint8_t Planner::reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr)) {
   // Initialize block index to the last block in the planner buffer.
   uint8_t block_index = prev_block_index(block_buffer_head);
 
@@ -1054,7 +1166,7 @@ void Planner::reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_
   // If there was a race condition and block_buffer_planned was incremented
   //  or was pointing at the head (queue empty) break loop now and avoid
   //  planning already consumed blocks
-  if (planned_block_index == block_buffer_head) return;
+  if (planned_block_index == block_buffer_head) return planned_block_index;
 
   // Reverse Pass: Coarsely maximize all possible deceleration curves back-planning from the last
   // block in buffer. Cease planning when the last optimal planned or tail pointer is reached.
@@ -1068,6 +1180,16 @@ void Planner::reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_
     // Only process movement blocks
     if (current->is_move()) {
       reverse_pass_kernel(current, next OPTARG(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr));
+      TERN_(BUFFER_MONITORING, kernel_calls++);
+
+      // If the entry speed of a block (other than the newest) didn't change, the entry speeds
+      // before it won't change either, since they only depend on the blocks that follow.
+      // The plan is stable up to this block, so stop here.
+      if (next && !current->flag.recalculate) {
+        TERN_(BUFFER_MONITORING, kernel_calls_skipped += BLOCK_MOD(block_index - planned_block_index) - 1);
+        return block_index;
+      }
+
       next = current;
     }
 
@@ -1080,12 +1202,14 @@ void Planner::reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_
     while (planned_block_index != block_buffer_planned) {
 
       // If we reached the busy block or an already processed block, break the loop now
-      if (block_index == planned_block_index) return;
+      if (block_index == planned_block_index) return planned_block_index;
 
       // Advance the pointer, following the busy block
       planned_block_index = next_block_index(planned_block_index);
     }
   }
+
+  return planned_block_index;
 }
 
 // The kernel called by recalculate() when scanning the plan from first to last entry.
@@ -1098,7 +1222,7 @@ void Planner::forward_pass_kernel(const block_t * const previous, block_t * cons
     if (!previous->flag.nominal_length && previous->entry_speed_sqr < current->entry_speed_sqr) {
 
       // Compute the maximum allowable speed
-      const float new_entry_speed_sqr = max_allowable_speed_sqr(-previous->acceleration, previous->entry_speed_sqr, previous->millimeters);
+      const speed_sqr_t new_entry_speed_sqr = accelerated_speed_sqr(previous, previous->entry_speed_sqr);
 
       // If true, current block is full-acceleration and we can move the planned pointer forward.
       if (new_entry_speed_sqr < current->entry_speed_sqr) {
@@ -1141,7 +1265,7 @@ void Planner::forward_pass_kernel(const block_t * const previous, block_t * cons
  * recalculate() needs to go over the current plan twice.
  * Once in reverse and once forward. This implements the forward pass.
  */
-void Planner::forward_pass() {
+void Planner::forward_pass(const uint8_t stable_index) {
 
   // Forward Pass: Forward plan the acceleration curve from the planned pointer onward.
   // Also scans for optimal plan breakpoints and appropriately updates the planned pointer.
@@ -1152,6 +1276,12 @@ void Planner::forward_pass() {
   //  pass will never modify the values at the tail.
   uint8_t block_index = block_buffer_planned;
 
+  // Skip the stable prefix found by the reverse pass, unless the ISR has already moved past it
+  if (BLOCK_MOD(block_buffer_head - stable_index) < BLOCK_MOD(block_buffer_head - block_index)) {
+    TERN_(BUFFER_MONITORING, kernel_calls_skipped += BLOCK_MOD(stable_index - block_index));
+    block_index = stable_index;
+  }
+
   block_t *block;
   const block_t * previous = nullptr;
   while (block_index != block_buffer_head) {
@@ -1166,8 +1296,10 @@ void Planner::forward_pass() {
       // the previous block became BUSY, so assume the current block's
       // entry speed can't be altered (since that would also require
       // updating the exit speed of the previous block).
-      if (!previous || !stepper.is_block_busy(previous))
+      if (!previous || !stepper.is_block_busy(previous)) {
         forward_pass_kernel(previous, block, block_index);
+        TERN_(BUFFER_MONITORING, kernel_calls++);
+      }
       previous = block;
     }
     // Advance to the previous
@@ -1179,11 +1311,21 @@ void Planner::forward_pass() {
  * Recalculate the trapezoid speed profiles for all blocks in the plan
  * according to the entry_factor for each junction. Must be called by
  * recalculate() after updating the blocks.
+ *
+ * Blocks before stable_index had no change of entry or exit speed,
+ * so the scan starts there instead of at the tail.
  */
-void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr)) {
+void Planner::recalculate_trapezoids(const uint8_t stable_index OPTARG(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr)) {
   // The tail may be changed by the ISR so get a local copy.
   uint8_t block_index = block_buffer_tail,
           head_block_index = block_buffer_head;
+
+  // Skip the stable prefix, unless the ISR has already moved past it
+  if (BLOCK_MOD(head_block_index - stable_index) < BLOCK_MOD(head_block_index - block_index)) {
+    TERN_(BUFFER_MONITORING, kernel_calls_skipped += BLOCK_MOD(stable_index - block_index));
+    block_index = stable_index;
+  }
+
   // Since there could be a sync block in the head of the queue, and the
   // next loop must not recalculate the head block (as it needs to be
   // specially handled), scan backwards to the first non-SYNC block.
@@ -1202,16 +1344,20 @@ void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t
     head_block_index = prev_index;
   }
 
-  // Go from the tail (currently executed block) to the first block, without including it)
+  // Go from the tail (currently executed block) or the stable prefix to the first block, without including it)
   block_t *block = nullptr, *next = nullptr;
-  float current_entry_speed = 0.0f, next_entry_speed = 0.0f;
+  #if ENABLED(PLANNER_FIXED_POINT)
+    speed_sqr_t current_entry_speed = 0, next_entry_speed = 0; // Speeds squared, passed as-is
+  #else
+    float current_entry_speed = 0.0f, next_entry_speed = 0.0f;
+  #endif
   while (block_index != head_block_index) {
 
     next = &block_buffer[block_index];
 
     // Only process movement blocks
     if (next->is_move()) {
-      next_entry_speed = SQRT(next->entry_speed_sqr);
+      next_entry_speed = TERN(PLANNER_FIXED_POINT, next->entry_speed_sqr, SQRT(next->entry_speed_sqr));
 
       if (block) {
 
@@ -1227,9 +1373,14 @@ void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t
           if (!stepper.is_block_busy(block)) {
             // Block is not BUSY, we won the race against the Stepper ISR:
 
-            // NOTE: Entry and exit factors always > 0 by all previous logic operations.
-            const float nomr = 1.0f / block->nominal_speed;
-            calculate_trapezoid_for_block(block, current_entry_speed * nomr, next_entry_speed * nomr);
+            #if ENABLED(PLANNER_FIXED_POINT)
+              calculate_trapezoid_for_block(block, current_entry_speed, next_entry_speed);
+            #else
+              // NOTE: Entry and exit factors always > 0 by all previous logic operations.
+              const float nomr = 1.0f / block->nominal_speed;
+              calculate_trapezoid_for_block(block, current_entry_speed * nomr, next_entry_speed * nomr);
+            #endif
+            TERN_(BUFFER_MONITORING, kernel_calls++);
           }
 
           // Reset current only to ensure next trapezoid is computed - The
@@ -1248,7 +1399,11 @@ void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t
   // Last/newest block in buffer. Always recalculated.
   if (block) {
     // Exit speed is set with MINIMUM_PLANNER_SPEED unless some code higher up knows better.
-    next_entry_speed = _MAX(TERN0(HINTS_SAFE_EXIT_SPEED, SQRT(safe_exit_speed_sqr)), float(MINIMUM_PLANNER_SPEED));
+    #if ENABLED(PLANNER_FIXED_POINT)
+      next_entry_speed = _MAX(speed_sqr_fixed(TERN0(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr)), min_planner_speed_sqr);
+    #else
+      next_entry_speed = _MAX(TERN0(HINTS_SAFE_EXIT_SPEED, SQRT(safe_exit_speed_sqr)), float(MINIMUM_PLANNER_SPEED));
+    #endif
 
     // Mark the next(last) block as RECALCULATE, to prevent the Stepper ISR running it.
     // As the last block is always recalculated here, there is a chance the block isn't
@@ -1261,8 +1416,13 @@ void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t
     if (!stepper.is_block_busy(block)) {
       // Block is not BUSY, we won the race against the Stepper ISR:
 
-      const float nomr = 1.0f / block->nominal_speed;
-      calculate_trapezoid_for_block(block, current_entry_speed * nomr, next_entry_speed * nomr);
+      #if ENABLED(PLANNER_FIXED_POINT)
+        calculate_trapezoid_for_block(block, current_entry_speed, next_entry_speed);
+      #else
+        const float nomr = 1.0f / block->nominal_speed;
+        calculate_trapezoid_for_block(block, current_entry_speed * nomr, next_entry_speed * nomr);
+      #endif
+      TERN_(BUFFER_MONITORING, kernel_calls++);
     }
 
     // Reset block to ensure its trapezoid is computed - The stepper is free to use
@@ -1274,12 +1434,15 @@ void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t
 void Planner::recalculate(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr)) {
   // Initialize block index to the last block in the planner buffer.
   const uint8_t block_index = prev_block_index(block_buffer_head);
+  // Blocks before this one are unchanged by the passes. The ISR may advance
+  // block_buffer_planned so get a stable local copy.
+  uint8_t stable_index = block_buffer_planned;
   // If there is just one block, no planning can be done. Avoid it!
-  if (block_index != block_buffer_planned) {
-    reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr));
-    forward_pass();
+  if (block_index != stable_index) {
+    stable_index = reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr));
+    forward_pass(stable_index);
   }
-  recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr));
+  recalculate_trapezoids(stable_index OPTARG(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr));
 }
 
 /**
@@ -2851,13 +3014,15 @@ bool Planner::_populate_block(
   #endif // Classic Jerk Limiting
 
   // Max entry speed of this block equals the max exit speed of the previous block.
-  block->max_entry_speed_sqr = vmax_junction_sqr;
+  block->max_entry_speed_sqr = speed_sqr_fixed(vmax_junction_sqr);
 
   // Initialize block entry speed. Compute based on deceleration to user-defined MINIMUM_PLANNER_SPEED.
   const float v_allowable_sqr = max_allowable_speed_sqr(-block->acceleration, sq(float(MINIMUM_PLANNER_SPEED)), block->millimeters);
 
   // Start with the minimum allowed speed
-  block->entry_speed_sqr = sq(float(MINIMUM_PLANNER_SPEED));
+  block->entry_speed_sqr = min_planner_speed_sqr;
+
+  TERN_(PLANNER_FIXED_POINT, fixed_point_block_setup(block));
 
   // Initialize planner efficiency flags
   // Set flag if block will always reach maximum junction speed regardless of entry/exit speeds.
@@ -3448,3 +3613,124 @@ void Planner::set_max_feedrate(const AxisEnum axis, float inMaxFeedrateMMS) {
   }
 
 #endif
+
+#if HAS_MPC_FEEDFORWARD
+
+  /**
+   * Estimate the filament feed rate (mm/s) for an extruder 'lead_s' seconds from now
+   * by adding up the queued moves at their nominal speeds. The block in progress counts
+   * in full, and acceleration is ignored, so this leans towards an early answer.
+   * If the queue runs out first, the last move's rate stands in for moves not yet planned.
+   * Retractions count as no extrusion.
+   *
+   * Called from the main loop while the Stepper ISR may release blocks, so this is only
+   * an estimate. Released blocks are not overwritten until the main loop plans more moves.
+   */
+  float Planner::extrusion_rate_ahead(const float lead_s, const uint8_t extruder) {
+    float time_s = 0, rate = 0;
+    for (uint8_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
+      block_t * const block = &block_buffer[b];
+      if (!block->is_move() || block->nominal_speed <= 0) continue;
+      const float block_s = block->millimeters / block->nominal_speed;
+      rate = (block->extruder != extruder || !block->direction_bits.e) ? 0
+           : block->steps.e * mm_per_step[E_AXIS_N(extruder)] / block_s;
+      time_s += block_s;
+      if (time_s >= lead_s) break;
+    }
+    return rate;
+  }
+
+#endif
+
+#if ENABLED(MARLIN_TEST_BUILD)
+
+  #include "../tests/marlin_tests.h"
+
+  /**
+   * Compare the trapezoid kernel against the reference float math over a
+   * range of synthetic blocks, then time both. Compare the output of builds
+   * with and without PLANNER_FIXED_POINT (e.g., on the Linux HAL).
+   */
+  void Planner::test_trapezoid_kernel() {
+    constexpr float steps_per_mm = 80;
+    constexpr uint16_t test_count = 1000;
+
+    // Reference: the float trapezoid math, given entry/exit speeds in mm/s
+    auto reference = [](block_t &b, const float entry, const float exit, uint32_t &accel_until, uint32_t &decel_after) {
+      const float nomr = 1.0f / b.nominal_speed;
+      uint32_t initial_rate = CEIL(b.nominal_rate * entry * nomr), final_rate = CEIL(b.nominal_rate * exit * nomr);
+      NOLESS(initial_rate, uint32_t(MINIMAL_STEP_RATE));
+      NOLESS(final_rate, uint32_t(MINIMAL_STEP_RATE));
+      const float half_inverse_accel = 0.5f / b.acceleration_steps_per_s2,
+                  nominal_rate_sq = sq(float(b.nominal_rate)),
+                  decel_float = half_inverse_accel * (nominal_rate_sq - sq(float(final_rate)));
+      float accel_float = half_inverse_accel * (nominal_rate_sq - sq(float(initial_rate)));
+      uint32_t accel_steps = _MAX(CEIL(accel_float), 0), decel_steps = _MAX(FLOOR(decel_float), 0);
+      if (int32_t(b.step_event_count) - int32_t(accel_steps + decel_steps) < 0) {
+        accel_float = CEIL((b.step_event_count + accel_float - decel_float) * 0.5f);
+        accel_steps = _MIN(uint32_t(_MAX(accel_float, 0)), b.step_event_count);
+        decel_steps = b.step_event_count - accel_steps;
+      }
+      accel_until = accel_steps;
+      decel_after = b.step_event_count - decel_steps;
+    };
+
+    // Deterministic pseudo-random block parameters
+    uint32_t seed;
+    auto rnd = [&seed](const uint32_t lo, const uint32_t hi) { seed = seed * 1103515245UL + 12345UL; return lo + (seed >> 8) % (hi - lo + 1); };
+
+    block_t b;
+    float entry, exit;
+    auto next_block = [&]{
+      b.reset();
+      b.step_event_count = rnd(10, 40000);
+      b.millimeters = b.step_event_count / steps_per_mm;
+      b.nominal_speed = rnd(5, 300);
+      b.nominal_rate = CEIL(b.nominal_speed * steps_per_mm);
+      b.acceleration = rnd(100, 10000);
+      b.acceleration_steps_per_s2 = b.acceleration * steps_per_mm;
+      TERN_(PLANNER_FIXED_POINT, fixed_point_block_setup(&b));
+      entry = b.nominal_speed * rnd(0, 1000) / 1000.0f;
+      exit = b.nominal_speed * rnd(0, 1000) / 1000.0f;
+    };
+    auto run_kernel = [&]{
+      #if ENABLED(PLANNER_FIXED_POINT)
+        calculate_trapezoid_for_block(&b, speed_sqr_fixed(sq(entry)), speed_sqr_fixed(sq(exit)));
+      #else
+        calculate_trapezoid_for_block(&b, entry / b.nominal_speed, exit / b.nominal_speed);
+      #endif
+    };
+
+    // Accuracy
+    uint16_t failures = 0;
+    seed = 12345;
+    for (uint16_t i = 0; i < test_count; i++) {
+      next_block();
+      uint32_t ref_until, ref_after;
+      reference(b, entry, exit, ref_until, ref_after);
+      run_kernel();
+
+      // Allow for rounding of the fixed-point speeds
+      const int32_t tol = _MAX(2UL, b.step_event_count / 200);
+      if (ABS(int32_t(b.accelerate_until - ref_until)) > tol || ABS(int32_t(b.decelerate_after - ref_after)) > tol) {
+        if (++failures <= 5)
+          SERIAL_ECHOLNPGM("Trapezoid mismatch: steps=", b.step_event_count, " until=", b.accelerate_until, "/", ref_until, " after=", b.decelerate_after, "/", ref_after);
+      }
+    }
+
+    // Speed, including the (identical) block setup in both timings
+    uint32_t ref_until, ref_after, t = testMicros();
+    seed = 12345;
+    for (uint16_t i = 0; i < test_count; i++) { next_block(); reference(b, entry, exit, ref_until, ref_after); }
+    const uint32_t reference_us = testMicros() - t;
+
+    t = testMicros();
+    seed = 12345;
+    for (uint16_t i = 0; i < test_count; i++) { next_block(); run_kernel(); }
+    const uint32_t kernel_us = testMicros() - t;
+
+    countTestFailures(failures);
+    SERIAL_ECHOLNPGM("Trapezoid kernel (", TERN(PLANNER_FIXED_POINT, "fixed", "float"), "): ", test_count, " blocks, ", failures, " mismatches, ", kernel_us, "us (reference ", reference_us, "us)");
+  }
+
+#endif // MARLIN_TEST_BUILD
@@ -190,6 +190,26 @@ typedef struct {
 
 #endif
 
+#if ENABLED(PLANNER_FIXED_POINT)
+  /**
+   * Speed-squared values in (mm/s)^2 as unsigned Q22.10 fixed-point.
+   * The range covers speeds up to 2047mm/s and saturates above that.
+   */
+  typedef uint32_t speed_sqr_t;
+  #define SPEED_SQR_FRACT 10
+  #define SPEED_SQR_MAX   UINT32_MAX
+
+  constexpr speed_sqr_t speed_sqr_fixed(const float v) {
+    return v <= 0 ? 0 : v >= float(SPEED_SQR_MAX >> (SPEED_SQR_FRACT)) ? SPEED_SQR_MAX : speed_sqr_t(v * (1UL << (SPEED_SQR_FRACT)) + 0.5f);
+  }
+  constexpr float speed_sqr_float(const speed_sqr_t v) { return float(v) * (1.0f / (1UL << (SPEED_SQR_FRACT))); }
+  constexpr speed_sqr_t speed_sqr_add(const speed_sqr_t a, const speed_sqr_t b) { return b > SPEED_SQR_MAX - a ? SPEED_SQR_MAX : a + b; }
+#else
+  typedef float speed_sqr_t;
+  constexpr speed_sqr_t speed_sqr_fixed(const float v) { return v; }
+  constexpr float speed_sqr_float(const speed_sqr_t v) { return v; }
+#endif
+
 /**
  * struct block_t
  *
@@ -211,11 +231,20 @@ typedef struct PlannerBlock {
 
   // Fields used by the motion planner to manage acceleration
   float nominal_speed,                      // The nominal speed for this block in (mm/sec)
-        entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
-        max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
         millimeters,                        // The total travel of this block in mm
         acceleration;                       // acceleration mm/sec^2
 
+  speed_sqr_t entry_speed_sqr,              // Entry speed at previous-current junction in (mm/sec)^2
+              max_entry_speed_sqr;          // Maximum allowable junction entry speed in (mm/sec)^2
+
+  #if ENABLED(PLANNER_FIXED_POINT)
+    speed_sqr_t accel_distance_sqr;         // Speed-squared change over the whole block: 2 * acceleration * millimeters
+    uint32_t rate_sqr_factor;               // (nominal_rate / nominal_speed)^2 as a 32-bit mantissa and shift,
+    uint8_t rate_sqr_shift;                 //  to convert fixed-point speed^2 into rate^2
+    uint16_t steps_factor;                  // 1 / (2 * acceleration_steps_per_s2) as a 16-bit mantissa and shift,
+    uint8_t steps_shift;                    //  to convert a change in rate^2 into a number of steps
+  #endif
+
   union {
     abce_ulong_t steps;                     // Step count along each axis
     abce_long_t position;                   // New position to force when this sync block is executed
@@ -410,6 +439,11 @@ class Planner {
     static uint16_t cleaning_buffer_counter;        // A counter to disable queuing of blocks
     static uint8_t delay_before_delivering;         // This counter delays delivery of blocks when queue becomes empty to allow the opportunity of merging blocks
 
+    #if ENABLED(BUFFER_MONITORING)
+      static uint32_t kernel_calls,                 // Reverse and forward pass kernels run...
+                      kernel_calls_skipped;         // ...and skipped due to a stable plan prefix
+    #endif
+
 
     #if ENABLED(DISTINCT_E_FACTORS)
       static uint8_t last_extruder;                 // Respond to extruder change
@@ -989,6 +1023,11 @@ class Planner {
       static void clear_block_buffer_runtime();
     #endif
 
+    #if HAS_MPC_FEEDFORWARD
+      // The planned filament feed rate for an extruder a given time ahead
+      static float extrusion_rate_ahead(const float lead_s, const uint8_t extruder);
+    #endif
+
     #if ENABLED(AUTOTEMP)
       static autotemp_t autotemp;
       static void autotemp_update();
@@ -1004,6 +1043,10 @@ class Planner {
       }
     #endif
 
+    #if ENABLED(MARLIN_TEST_BUILD)
+      static void test_trapezoid_kernel();
+    #endif
+
   private:
 
     #if ENABLED(AUTOTEMP)
@@ -1029,6 +1072,18 @@ class Planner {
       return target_velocity_sqr - 2 * accel * distance;
     }
 
+    /**
+     * Speed squared after accelerating from 'speed_sqr' over the full block length.
+     * Used by both planner passes: backward from the exit, forward from the entry.
+     */
+    static speed_sqr_t accelerated_speed_sqr(const block_t * const block, const speed_sqr_t speed_sqr) {
+      #if ENABLED(PLANNER_FIXED_POINT)
+        return speed_sqr_add(speed_sqr, block->accel_distance_sqr);
+      #else
+        return max_allowable_speed_sqr(-block->acceleration, speed_sqr, block->millimeters);
+      #endif
+    }
+
     #if EITHER(S_CURVE_ACCELERATION, LIN_ADVANCE)
       /**
        * Calculate the speed reached given initial speed, acceleration and distance
@@ -1038,15 +1093,19 @@ class Planner {
       }
     #endif
 
-    static void calculate_trapezoid_for_block(block_t * const block, const_float_t entry_factor, const_float_t exit_factor);
+    #if ENABLED(PLANNER_FIXED_POINT)
+      static void calculate_trapezoid_for_block(block_t * const block, const speed_sqr_t entry_speed_sqr, const speed_sqr_t exit_speed_sqr);
+    #else
+      static void calculate_trapezoid_for_block(block_t * const block, const_float_t entry_factor, const_float_t exit_factor);
+    #endif
 
     static void reverse_pass_kernel(block_t * const current, const block_t * const next OPTARG(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
     static void forward_pass_kernel(const block_t * const previous, block_t * const current, uint8_t block_index);
 
-    static void reverse_pass(TERN_(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
-    static void forward_pass();
+    static uint8_t reverse_pass(TERN_(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
+    static void forward_pass(const uint8_t stable_index);
 
-    static void recalculate_trapezoids(TERN_(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
+    static void recalculate_trapezoids(const uint8_t stable_index OPTARG(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
 
     static void recalculate(TERN_(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
 
@@ -660,7 +660,9 @@ void MarlinSettings::postprocess() {
 
   TERN_(ENABLE_LEVELING_FADE_HEIGHT, set_z_fade_height(new_z_fade_height, false)); // false = no report
 
-  TERN_(AUTO_BED_LEVELING_BILINEAR, bedlevel.refresh_bed_level());
+  #if EITHER(AUTO_BED_LEVELING_BILINEAR, AUTO_BED_LEVELING_UBL)
+    bedlevel.refresh_bed_level();
+  #endif
 
   TERN_(HAS_MOTOR_CURRENT_PWM, stepper.refresh_motor_power());
 
@@ -2144,7 +2146,10 @@ void MarlinSettings::postprocess() {
         user_thermistor_t user_thermistor[USER_THERMISTORS];
         _FIELD_TEST(user_thermistor);
         EEPROM_READ(user_thermistor);
-        if (!validating) COPY(thermalManager.user_thermistor, user_thermistor);
+        if (!validating) {
+          COPY(thermalManager.user_thermistor, user_thermistor);
+          TERN_(HAS_USER_THERMISTOR_TABLE, LOOP_L_N(i, USER_THERMISTORS) thermalManager.update_user_thermistor(i));
+        }
       }
       #endif
 
@@ -2673,7 +2678,16 @@ void MarlinSettings::postprocess() {
       //
       #if ENABLED(FT_MOTION)
         _FIELD_TEST(fxdTiCtrl_cfg);
+        fxdTiCtrl.holdTask(true);
         EEPROM_READ(fxdTiCtrl.cfg);
+        if (!validating) {
+          #if HAS_X_AXIS
+            fxdTiCtrl.refreshShapingN();
+            fxdTiCtrl.updateShapingA();
+          #endif
+          fxdTiCtrl.reset();
+        }
+        fxdTiCtrl.holdTask(false);
       #endif
 
       //
@@ -2905,6 +2919,8 @@ void MarlinSettings::postprocess() {
             ui.status_printf(0, GET_TEXT_F(MSG_MESH_LOADED), bedlevel.storage_slot);
         #endif
 
+        if (!into) bedlevel.refresh_bed_level();
+
         if (status) SERIAL_ECHOLNPGM("?Unable to load mesh data.");
         else        DEBUG_ECHOLNPGM("Mesh loaded from slot ", slot);
 
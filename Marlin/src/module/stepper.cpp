@@ -96,6 +96,10 @@ Stepper stepper; // Singleton
   #include "ft_motion.h"
 #endif
 
+#if ENABLED(STEP_TRACE)
+  #include "../feature/step_trace.h"
+#endif
+
 #include "../lcd/marlinui.h"
 #include "../gcode/queue.h"
 #include "../sd/cardreader.h"
@@ -1494,6 +1498,9 @@ void Stepper::isr() {
 
     hal_timer_t interval;
 
+    // Tick of this pass for the step trace
+    TERN_(STEP_TRACE, step_trace.now = step_trace.isr_ticks + next_isr_ticks);
+
     #if ENABLED(FT_MOTION)
 
       // NOTE STEPPER_TIMER_RATE is equal to 2000000, not what VSCode shows
@@ -1515,19 +1522,19 @@ void Stepper::isr() {
 
               fxdTiCtrl.sts_stepperBusy = true;
 
-              // "Pop" one command from the command buffer.
-              fxdTiCtrl_stepCmd = fxdTiCtrl.stepperCmdBuff[fxdTiCtrl.stepperCmdBuff_consumeIdx];
-              const uint8_t dir_index = fxdTiCtrl.stepperCmdBuff_consumeIdx >> 3,
-                            dir_bit = fxdTiCtrl.stepperCmdBuff_consumeIdx & 0x7;
-              fxdTiCtrl_applyDir = TEST(fxdTiCtrl.stepperCmdBuff_ApplyDir[dir_index], dir_bit);
-              nextMainISR = fxdTiCtrl.stepperCmdBuff_StepRelativeTi[fxdTiCtrl.stepperCmdBuff_consumeIdx];
-              fxdTiCtrl_stepCmdRdy = true;
+              // "Pop" one command from the command buffer and unpack it.
+              const ft_packed_command_t packed = fxdTiCtrl.stepperCmdBuff[fxdTiCtrl.stepperCmdBuff_consumeIdx];
+              fxdTiCtrl_stepCmd = ft_command_t(packed);
+              fxdTiCtrl_applyDir = TEST(packed, FT_BIT_APPLY_DIR);
+              nextMainISR = (packed >> (FT_INTERVALS_SHIFT)) * (FTM_MIN_TICKS);
+              fxdTiCtrl_stepCmdRdy = fxdTiCtrl_stepCmd; // A command with no steps only waits.
 
               if (++fxdTiCtrl.stepperCmdBuff_consumeIdx == (FTM_STEPPERCMD_BUFF_SIZE))
                 fxdTiCtrl.stepperCmdBuff_consumeIdx = 0;
 
             }
             else { // Buffer empty.
+              if (fxdTiCtrl.sts_stepperBusy && fxdTiCtrl.producerPending()) fxdTiCtrl.underruns++;
               fxdTiCtrl.sts_stepperBusy = false;
               nextMainISR = 0.01f * (STEPPER_TIMER_RATE); // Come back in 10 msec.
             }
@@ -1694,6 +1701,7 @@ void Stepper::isr() {
 
   // Set the next ISR to fire at the proper time
   HAL_timer_set_compare(MF_TIMER_STEP, next_isr_ticks);
+  TERN_(STEP_TRACE, step_trace.isr_ticks += next_isr_ticks);
 
   // Don't forget to finally reenable interrupts on non-AVR.
   // AVR automatically calls sei() for us on Return-from-Interrupt.
@@ -2006,6 +2014,8 @@ void Stepper::pulse_phase_isr() {
         AWAIT_LOW_PULSE();
     #endif
 
+    TERN_(STEP_TRACE, step_trace.record(step_needed, last_direction_bits, planner.block_buffer_tail));
+
     // Pulse start
     #if HAS_X_STEP
       PULSE_START(X);
@@ -2121,6 +2131,7 @@ void Stepper::pulse_phase_isr() {
       #endif
 
       TERN_(I2S_STEPPER_STREAM, i2s_push_sample());
+      TERN_(STEP_TRACE, step_trace.record(step_needed, last_direction_bits, planner.block_buffer_tail));
 
       USING_TIMED_PULSE();
       if (bool(step_needed)) {
@@ -2780,6 +2791,8 @@ hal_timer_t Stepper::block_phase_isr() {
 
       // Set the STEP pulse ON
       E_STEP_WRITE(TERN(MIXING_EXTRUDER, mixer.get_next_stepper(), stepper_extruder), STEP_STATE_E);
+
+      TERN_(STEP_TRACE, step_trace.record(_BV(E_AXIS), last_direction_bits.bits, planner.block_buffer_tail));
     }
 
     TERN_(I2S_STEPPER_STREAM, i2s_push_sample());
@@ -3433,6 +3446,19 @@ void Stepper::report_positions() {
 
     START_TIMED_PULSE();
 
+    #if ENABLED(STEP_TRACE)
+      // Directions are only valid for the axes stepped
+      AxisBits steps, dirs;
+      #define _FT_TRACE(A) do{ steps.bits |= TEST(command, FT_BIT_STEP_##A) ? _BV(A##_AXIS) : 0; \
+                               dirs.bits |= TEST(command, FT_BIT_DIR_##A) ? _BV(A##_AXIS) : 0; }while(0)
+      TERN_(HAS_X_AXIS, _FT_TRACE(X));
+      TERN_(HAS_Y_AXIS, _FT_TRACE(Y));
+      TERN_(HAS_Z_AXIS, _FT_TRACE(Z));
+      TERN_(HAS_EXTRUDERS, _FT_TRACE(E));
+      #undef _FT_TRACE
+      step_trace.record(steps.bits, dirs.bits, planner.block_buffer_tail);
+    #endif
+
     #if HAS_Z_AXIS
       // Update step counts
       if (z_step) count_position.z += z_fwd ? 1 : -1;
@@ -3499,24 +3525,25 @@ void Stepper::report_positions() {
                                 // or the set conditions should be changed from the block to
                                 // the motion trajectory or motor commands.
 
+    // There is no block while the commands of the last one are output
     AxisBits axis_bits;
 
     static uint32_t a_debounce = 0U;
-    if (!!current_block->steps.a) a_debounce = (AXIS_DID_MOVE_DEB) * 400; // divide by 0.0025f
+    if (current_block && current_block->steps.a) a_debounce = (AXIS_DID_MOVE_DEB) * 400; // divide by 0.0025f
     if (a_debounce) { axis_bits.a = true; a_debounce--; }
     #if HAS_Y_AXIS
       static uint32_t b_debounce = 0U;
-      if (!!current_block->steps.b) b_debounce = (AXIS_DID_MOVE_DEB) * 400;
+      if (current_block && current_block->steps.b) b_debounce = (AXIS_DID_MOVE_DEB) * 400;
       if (b_debounce) { axis_bits.b = true; b_debounce--; }
     #endif
     #if HAS_Z_AXIS
       static uint32_t c_debounce = 0U;
-      if (!!current_block->steps.c) c_debounce = (AXIS_DID_MOVE_DEB) * 400;
+      if (current_block && current_block->steps.c) c_debounce = (AXIS_DID_MOVE_DEB) * 400;
       if (c_debounce) { axis_bits.c = true; c_debounce--; }
     #endif
     #if HAS_EXTRUDERS
       static uint32_t e_debounce = 0U;
-      if (!!current_block->steps.e) e_debounce = (AXIS_DID_MOVE_DEB) * 400;
+      if (current_block && current_block->steps.e) e_debounce = (AXIS_DID_MOVE_DEB) * 400;
       if (e_debounce) { axis_bits.e = true; e_debounce--; }
     #endif
 
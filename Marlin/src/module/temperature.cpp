@@ -164,6 +164,10 @@
   #include "../feature/babystep.h"
 #endif
 
+#if ENABLED(FTM_TIMER_TASK)
+  #include "ft_motion.h"
+#endif
+
 #if ENABLED(FILAMENT_WIDTH_SENSOR)
   #include "../feature/filwidth.h"
 #endif
@@ -172,6 +176,10 @@
   #include "../feature/power_monitor.h"
 #endif
 
+#if HAS_POWER_BUDGET
+  #include "../feature/power_budget.h"
+#endif
+
 #if ENABLED(EMERGENCY_PARSER)
   #include "../feature/e_parser.h"
 #endif
@@ -621,7 +629,9 @@ volatile bool Temperature::raw_temps_ready = false;
 
 #if MAX_CONSECUTIVE_LOW_TEMPERATURE_ERROR_ALLOWED > 1
   #define MULTI_MAX_CONSECUTIVE_LOW_TEMP_ERR 1
-  uint8_t Temperature::consecutive_low_temperature_error[HOTENDS]; // = { 0 }
+  // As many readings in a row as span the same time at the classic update rate
+  #define LOW_TEMP_ERRORS_ALLOWED TERN(ADC_DMA_RING, ((MAX_CONSECUTIVE_LOW_TEMPERATURE_ERROR_ALLOWED) * (OVERSAMPLENR) / (TEMP_UPDATE_LOOPS)), MAX_CONSECUTIVE_LOW_TEMPERATURE_ERROR_ALLOWED)
+  TERN(ADC_DMA_RING, uint16_t, uint8_t) Temperature::consecutive_low_temperature_error[HOTENDS]; // = { 0 }
 #endif
 
 #if PREHEAT_TIME_HOTEND_MS > 0
@@ -1315,22 +1325,31 @@ volatile bool Temperature::raw_temps_ready = false;
 
 #endif // MPC_AUTOTUNE
 
+// The power applied, which a power budget may cut below what the controller asked for
+#if HAS_POWER_BUDGET
+  #define _APPLIED_PWM(I,T) power_budget.granted(I, T.soft_pwm_amount)
+#else
+  #define _APPLIED_PWM(I,T) T.soft_pwm_amount
+#endif
+
 int16_t Temperature::getHeaterPower(const heater_id_t heater_id) {
   switch (heater_id) {
     #if HAS_HEATED_BED
-      case H_BED: return temp_bed.soft_pwm_amount;
+      case H_BED: return _APPLIED_PWM(POWER_BUDGET_BED, temp_bed);
     #endif
     #if HAS_HEATED_CHAMBER
-      case H_CHAMBER: return temp_chamber.soft_pwm_amount;
+      case H_CHAMBER: return _APPLIED_PWM(POWER_BUDGET_CHAMBER, temp_chamber);
     #endif
     #if HAS_COOLER
       case H_COOLER: return temp_cooler.soft_pwm_amount;
     #endif
     default:
-      return TERN0(HAS_HOTEND, temp_hotend[heater_id].soft_pwm_amount);
+      return TERN0(HAS_HOTEND, _APPLIED_PWM(heater_id, temp_hotend[heater_id]));
   }
 }
 
+#undef _APPLIED_PWM
+
 #if HAS_AUTO_FAN
 
   #define _EFANOVERLAP(I,N) ((I != N) && _FANOVERLAP(I,E##N))
@@ -1556,14 +1575,14 @@ void Temperature::mintemp_error(const heater_id_t heater_id) {
 
     PIDRunner(TT &t) : tempinfo(t) { }
 
-    float get_pid_output(const uint8_t extr=0) {
+    float get_pid_output(const uint8_t extr=0, const bool hold_i=false) {
       #if ENABLED(PID_OPENLOOP)
 
         return constrain(tempinfo.target, 0, MAX_POW);
 
       #else // !PID_OPENLOOP
 
-        float out = tempinfo.pid.get_pid_output(tempinfo.target, tempinfo.celsius);
+        float out = tempinfo.pid.get_pid_output(tempinfo.target, tempinfo.celsius, hold_i);
 
         #if ENABLED(PID_FAN_SCALING)
           out += tempinfo.pid.get_fan_scale_output(thermalManager.fan_speed[extr]);
@@ -1615,7 +1634,7 @@ void Temperature::mintemp_error(const heater_id_t heater_id) {
         REPEAT(HOTENDS, _HOTENDPID)
       };
 
-      const float pid_output = is_idling ? 0 : hotend_pid[ee].get_pid_output(ee);
+      const float pid_output = is_idling ? 0 : hotend_pid[ee].get_pid_output(ee, TERN0(HAS_POWER_BUDGET, power_budget.starved(ee)));
 
       #if ENABLED(PID_DEBUG)
         if (ee == active_extruder)
@@ -1646,6 +1665,11 @@ void Temperature::mintemp_error(const heater_id_t heater_id) {
         ambient_xfer_coeff += fan_fraction * mpc.fan255_adjustment;
       #endif
 
+      #if HAS_MPC_FEEDFORWARD
+        // The model uses the filament fed so far, but power is planned for the filament to come
+        float power_xfer_coeff = ambient_xfer_coeff;
+      #endif
+
       if (this_hotend) {
         const int32_t e_position = stepper.position(E_AXIS);
         const float e_speed = (e_position - MPC::e_position) * planner.mm_per_step[E_AXIS] / MPC_dT;
@@ -1657,10 +1681,14 @@ void Temperature::mintemp_error(const heater_id_t heater_id) {
           if (!MPC::e_paused) ambient_xfer_coeff += e_speed * mpc.filament_heat_capacity_permm;
           MPC::e_position = e_position;
         }
+        #if HAS_MPC_FEEDFORWARD
+          if (!MPC::e_paused) power_xfer_coeff += planner.extrusion_rate_ahead(MPC_FEEDFORWARD_LEAD, ee) * mpc.filament_heat_capacity_permm;
+        #endif
       }
 
-      // Update the modeled temperatures
-      float blocktempdelta = hotend.soft_pwm_amount * mpc.heater_power * (MPC_dT / 127) / mpc.block_heat_capacity;
+      // Update the modeled temperatures with the power the heater actually got
+      const uint8_t applied_pwm = TERN(HAS_POWER_BUDGET, power_budget.granted(ee, hotend.soft_pwm_amount), hotend.soft_pwm_amount);
+      float blocktempdelta = applied_pwm * mpc.heater_power * (MPC_dT / 127) / mpc.block_heat_capacity;
       blocktempdelta += (hotend.modeled_ambient_temp - hotend.modeled_block_temp) * ambient_xfer_coeff * MPC_dT / mpc.block_heat_capacity;
       hotend.modeled_block_temp += blocktempdelta;
 
@@ -1669,19 +1697,19 @@ void Temperature::mintemp_error(const heater_id_t heater_id) {
 
       // Any delta between hotend.modeled_sensor_temp and hotend.celsius is either model
       // error diverging slowly or (fast) noise. Slowly correct towards this temperature and noise will average out.
-      const float delta_to_apply = (hotend.celsius - hotend.modeled_sensor_temp) * (MPC_SMOOTHING_FACTOR);
+      const float delta_to_apply = (hotend.celsius - hotend.modeled_sensor_temp) * (MPC_SMOOTHING);
       hotend.modeled_block_temp += delta_to_apply;
       hotend.modeled_sensor_temp += delta_to_apply;
 
       // Only correct ambient when close to steady state (output power is not clipped or asymptotic temperature is reached)
-      if (WITHIN(hotend.soft_pwm_amount, 1, 126) || fabs(blocktempdelta + delta_to_apply) < (MPC_STEADYSTATE * MPC_dT))
+      if (WITHIN(applied_pwm, 1, 126) || fabs(blocktempdelta + delta_to_apply) < (MPC_STEADYSTATE * MPC_dT))
         hotend.modeled_ambient_temp += delta_to_apply > 0.f ? _MAX(delta_to_apply, MPC_MIN_AMBIENT_CHANGE * MPC_dT) : _MIN(delta_to_apply, -MPC_MIN_AMBIENT_CHANGE * MPC_dT);
 
       float power = 0.0;
       if (hotend.target != 0 && !is_idling) {
         // Plan power level to get to target temperature in 2 seconds
         power = (hotend.target - hotend.modeled_block_temp) * mpc.block_heat_capacity / 2.0f;
-        power -= (hotend.modeled_ambient_temp - hotend.modeled_block_temp) * ambient_xfer_coeff;
+        power -= (hotend.modeled_ambient_temp - hotend.modeled_block_temp) * TERN(HAS_MPC_FEEDFORWARD, power_xfer_coeff, ambient_xfer_coeff);
       }
 
       float pid_output = power * 254.0f / mpc.heater_power + 1.0f;        // Ensure correct quantization into a range of 0 to 127
@@ -1717,7 +1745,7 @@ void Temperature::mintemp_error(const heater_id_t heater_id) {
 
   float Temperature::get_pid_output_bed() {
     static PIDRunner<bed_info_t> bed_pid(temp_bed);
-    const float pid_output = bed_pid.get_pid_output();
+    const float pid_output = bed_pid.get_pid_output(0, TERN0(HAS_POWER_BUDGET, power_budget.starved(POWER_BUDGET_BED)));
     TERN_(PID_BED_DEBUG, bed_pid.debug(temp_bed.celsius, pid_output, F("(Bed)")));
     return pid_output;
   }
@@ -1728,7 +1756,7 @@ void Temperature::mintemp_error(const heater_id_t heater_id) {
 
   float Temperature::get_pid_output_chamber() {
     static PIDRunner<chamber_info_t> chamber_pid(temp_chamber);
-    const float pid_output = chamber_pid.get_pid_output();
+    const float pid_output = chamber_pid.get_pid_output(0, TERN0(HAS_POWER_BUDGET, power_budget.starved(POWER_BUDGET_CHAMBER)));
     TERN_(PID_CHAMBER_DEBUG, chamber_pid.debug(temp_chamber.celsius, pid_output, F("(Chamber)")));
     return pid_output;
   }
@@ -2125,6 +2153,8 @@ void Temperature::task() {
   // Handle Heated Chamber Temp Errors, Heating Watch, etc.
   TERN_(HAS_HEATED_CHAMBER, manage_heated_chamber(ms));
 
+  TERN_(HAS_POWER_BUDGET, power_budget.apply(ms));
+
   // Handle Cooler Temp Errors, Cooling Watch, etc.
   TERN_(HAS_COOLER, manage_cooler(ms));
 
@@ -2148,24 +2178,28 @@ void Temperature::task() {
 /**
  * Bisect search for the range of the 'raw' value, then interpolate
  * proportionally between the under and over values.
+ * RD reads a word of the table, from PROGMEM or from RAM.
  */
-#define SCAN_THERMISTOR_TABLE(TBL,LEN) do{                                \
+#define _SCAN_THERMISTOR_TABLE(TBL,LEN,RD) do{                            \
   uint8_t l = 0, r = LEN, m;                                              \
   for (;;) {                                                              \
     m = (l + r) >> 1;                                                     \
-    if (!m) return celsius_t(pgm_read_word(&TBL[0].celsius));             \
-    if (m == l || m == r) return celsius_t(pgm_read_word(&TBL[LEN-1].celsius)); \
-    raw_adc_t v00 = pgm_read_word(&TBL[m-1].value),                       \
-              v10 = pgm_read_word(&TBL[m-0].value);                       \
+    if (!m) return celsius_t(RD(&TBL[0].celsius));                        \
+    if (m == l || m == r) return celsius_t(RD(&TBL[LEN-1].celsius));      \
+    raw_adc_t v00 = RD(&TBL[m-1].value),                                  \
+              v10 = RD(&TBL[m-0].value);                                  \
          if (raw < v00) r = m;                                            \
     else if (raw > v10) l = m;                                            \
     else {                                                                \
-      const celsius_t v01 = celsius_t(pgm_read_word(&TBL[m-1].celsius)),  \
-                      v11 = celsius_t(pgm_read_word(&TBL[m-0].celsius));  \
+      const celsius_t v01 = celsius_t(RD(&TBL[m-1].celsius)),             \
+                      v11 = celsius_t(RD(&TBL[m-0].celsius));             \
       return v01 + (raw - v00) * float(v11 - v01) / float(v10 - v00);     \
     }                                                                     \
   }                                                                       \
 }while(0)
+#define SCAN_THERMISTOR_TABLE(TBL,LEN) _SCAN_THERMISTOR_TABLE(TBL,LEN,pgm_read_word)
+#define _RAM_WORD(A) (*(A))
+#define SCAN_RAM_THERMISTOR_TABLE(TBL,LEN) _SCAN_THERMISTOR_TABLE(TBL,LEN,_RAM_WORD)
 
 #if HAS_USER_THERMISTORS
 
@@ -2217,6 +2251,7 @@ void Temperature::task() {
       #endif
     };
     COPY(user_thermistor, default_user_thermistor);
+    TERN_(HAS_USER_THERMISTOR_TABLE, LOOP_L_N(i, USER_THERMISTORS) update_user_thermistor(i));
   }
 
   void Temperature::M305_report(const uint8_t t_index, const bool forReplay/*=true*/) {
@@ -2250,25 +2285,15 @@ void Temperature::task() {
     SERIAL_EOL();
   }
 
-  celsius_float_t Temperature::user_thermistor_to_deg_c(const uint8_t t_index, const raw_adc_t raw) {
-
-    if (!WITHIN(t_index, 0, COUNT(user_thermistor) - 1)) return 25;
-
-    user_thermistor_t &t = user_thermistor[t_index];
-    if (t.pre_calc) { // pre-calculate some variables
-      t.pre_calc     = false;
-      t.res_25_recip = 1.0f / t.res_25;
-      t.res_25_log   = logf(t.res_25);
-      t.beta_recip   = 1.0f / t.beta;
-      t.sh_alpha     = RECIPROCAL(THERMISTOR_RESISTANCE_NOMINAL_C - (THERMISTOR_ABS_ZERO_C))
-                        - (t.beta_recip * t.res_25_log) - (t.sh_c_coeff * cu(t.res_25_log));
-    }
+  // Maximum ADC value .. take into account the over sampling
+  constexpr raw_adc_t user_adc_max = MAX_RAW_THERMISTOR_VALUE;
 
-    // Maximum ADC value .. take into account the over sampling
-    constexpr raw_adc_t adc_max = MAX_RAW_THERMISTOR_VALUE;
-    const raw_adc_t adc_raw = constrain(raw, 1, adc_max - 1); // constrain to prevent divide-by-zero
-
-    const float adc_inverse = (adc_max - adc_raw) - 0.5f,
+  /**
+   * Steinhart-Hart equation (the Beta equation when C is 0) for a raw ADC value.
+   * Returns degrees C (up to 999, as the LCD only displays 3 digits)
+   */
+  static celsius_float_t user_thermistor_equation(const user_thermistor_t &t, const float adc_raw) {
+    const float adc_inverse = (user_adc_max - adc_raw) - 0.5f,
                 resistance = t.series_res * (adc_raw + 0.5f) / adc_inverse,
                 log_resistance = logf(resistance);
 
@@ -2278,10 +2303,158 @@ void Temperature::task() {
       value += t.sh_c_coeff * cu(log_resistance);
     value = 1.0f / value;
 
-    // Return degrees C (up to 999, as the LCD only displays 3 digits)
     return _MIN(value + THERMISTOR_ABS_ZERO_C, 999);
   }
-#endif
+
+  #if HAS_USER_THERMISTOR_TABLE
+
+    temp_entry_t Temperature::user_thermistor_table[USER_THERMISTORS][USER_THERMISTOR_TABLE_SIZE];
+    uint8_t Temperature::user_thermistor_table_len[USER_THERMISTORS];
+
+    #define USER_TABLE_MINTEMP -20
+    #define USER_TABLE_MAXTEMP 999
+
+    /**
+     * The raw ADC value (unclamped) for a temperature, solving the
+     * Steinhart-Hart equation for log(R) by Newton's method.
+     */
+    static float user_thermistor_raw(const user_thermistor_t &t, const celsius_float_t celsius) {
+      const float inv_t = 1.0f / (celsius - (THERMISTOR_ABS_ZERO_C));
+      float log_resistance = (inv_t - t.sh_alpha) * t.beta;
+      if (t.sh_c_coeff != 0) LOOP_L_N(i, 4)
+        log_resistance -= (t.sh_alpha + log_resistance * t.beta_recip + t.sh_c_coeff * cu(log_resistance) - inv_t)
+                        / (t.beta_recip + 3 * t.sh_c_coeff * sq(log_resistance));
+      const float resistance = expf(log_resistance);
+      return resistance * user_adc_max / (resistance + t.series_res) - 0.5f;
+    }
+
+    /**
+     * Build the interpolation table for a user thermistor.
+     *
+     * Linear interpolation error goes with the curvature, so the entries are spread to give each
+     * span an equal share of the integral of sqrt|d²T/draw²|, sampled at 2N points over the range.
+     * Entries are at whole ADC values, with the temperature rounded as in the built-in tables.
+     */
+    static uint8_t build_user_thermistor_table(const user_thermistor_t &t, temp_entry_t * const tbl) {
+      constexpr uint8_t N = USER_THERMISTOR_TABLE_SIZE;
+      constexpr uint16_t S = 2 * N;
+      const float lo = _MAX(1.0f, user_thermistor_raw(t, USER_TABLE_MAXTEMP)),
+                  hi = _MIN(float(user_adc_max - 1), user_thermistor_raw(t, USER_TABLE_MINTEMP)),
+                  h = (hi - lo) / S;
+
+      uint8_t len = 0;
+      auto add_entry = [&](const float raw) {
+        const raw_adc_t r = LROUND(raw);
+        if (len && r <= tbl[len - 1].value) return;
+        tbl[len].value = r;
+        tbl[len].celsius = LROUND(user_thermistor_equation(t, r));
+        len++;
+      };
+
+      // First pass totals the weights, the second places an entry each time the total passes a step
+      float total = 0;
+      LOOP_L_N(pass, 2) {
+        const float step = total / (N - 1);
+        float target = step, sum = 0,
+              t0 = user_thermistor_equation(t, lo),
+              t1 = user_thermistor_equation(t, lo + h),
+              t2 = user_thermistor_equation(t, lo + 2 * h),
+              w0 = SQRT(ABS(t0 - 2 * t1 + t2));              // Weight at sample 0, same as sample 1
+        if (pass) add_entry(lo);
+        for (uint16_t i = 0; i < S; ++i) {
+          // Weight at sample i + 1, then the span weight by the trapezoid rule
+          const float w1 = i + 1 < S ? SQRT(ABS(t0 - 2 * t1 + t2)) : w0,
+                      span = 0.5f * (w0 + w1);
+          if (pass) {
+            for (; target < sum + span && len < N - 1; target += step)
+              add_entry(lo + h * (i + (target - sum) / span));
+          }
+          sum += span;
+          w0 = w1;
+          t0 = t1; t1 = t2;
+          if (i + 3 <= S) t2 = user_thermistor_equation(t, lo + h * (i + 3));
+        }
+        total = sum;
+      }
+      if (len < N) add_entry(hi);
+      return len;
+    }
+
+  #endif // HAS_USER_THERMISTOR_TABLE
+
+  /**
+   * Pre-calculate the values derived from the user thermistor
+   * parameters, and build the thermistor's lookup table.
+   */
+  void Temperature::update_user_thermistor(const uint8_t t_index) {
+    user_thermistor_t &t = user_thermistor[t_index];
+    t.pre_calc     = false;
+    t.res_25_recip = 1.0f / t.res_25;
+    t.res_25_log   = logf(t.res_25);
+    t.beta_recip   = 1.0f / t.beta;
+    t.sh_alpha     = RECIPROCAL(THERMISTOR_RESISTANCE_NOMINAL_C - (THERMISTOR_ABS_ZERO_C))
+                      - (t.beta_recip * t.res_25_log) - (t.sh_c_coeff * cu(t.res_25_log));
+    TERN_(HAS_USER_THERMISTOR_TABLE, user_thermistor_table_len[t_index] = build_user_thermistor_table(t, user_thermistor_table[t_index]));
+  }
+
+  celsius_float_t Temperature::user_thermistor_to_deg_c(const uint8_t t_index, const raw_adc_t raw) {
+
+    if (!WITHIN(t_index, 0, COUNT(user_thermistor) - 1)) return 25;
+
+    if (user_thermistor[t_index].pre_calc) update_user_thermistor(t_index);
+
+    #if HAS_USER_THERMISTOR_TABLE
+      SCAN_RAM_THERMISTOR_TABLE(user_thermistor_table[t_index], user_thermistor_table_len[t_index]);
+    #else
+      return user_thermistor_equation(user_thermistor[t_index], constrain(raw, 1, user_adc_max - 1)); // constrain to prevent divide-by-zero
+    #endif
+  }
+
+  #if HAS_USER_THERMISTOR_TABLE && ENABLED(MARLIN_TEST_BUILD)
+
+    #include "../tests/marlin_tests.h"
+
+    /**
+     * Compare each table with the equation at every ADC value in its range. The tolerance
+     * is 1°C, or the temperature change over one step of the ADC, where that is larger.
+     */
+    void Temperature::test_user_thermistor_tables() {
+      LOOP_L_N(i, USER_THERMISTORS) {
+        const user_thermistor_t &t = user_thermistor[i];
+        const raw_adc_t lo = user_thermistor_table[i][0].value,
+                        hi = user_thermistor_table[i][user_thermistor_table_len[i] - 1].value;
+        uint32_t failures = 0;
+        float max_error = 0;
+        for (raw_adc_t raw = _MAX(lo, raw_adc_t(OVERSAMPLENR)); raw <= hi && raw < user_adc_max - (OVERSAMPLENR); ++raw) {
+          const float exact = user_thermistor_equation(t, raw),
+                      error = ABS(user_thermistor_to_deg_c(i, raw) - exact),
+                      tol = _MAX(1.0f, 0.5f * ABS(user_thermistor_equation(t, raw + (OVERSAMPLENR)) - user_thermistor_equation(t, raw - (OVERSAMPLENR))));
+          NOLESS(max_error, error);
+          if (error > tol && ++failures <= 5)
+            SERIAL_ECHOLNPGM("Thermistor table mismatch: P", i, " raw=", raw, " table=", user_thermistor_to_deg_c(i, raw), " exact=", exact);
+        }
+
+        // Speed of the table against the equation, over the same raw values
+        constexpr uint16_t test_count = 1000;
+        const raw_adc_t span = hi - lo;
+        volatile float sink = 0;
+        uint32_t us = testMicros();
+        for (uint16_t n = 0; n < test_count; n++) sink += user_thermistor_equation(t, lo + uint32_t(n) * span / test_count);
+        const uint32_t equation_us = testMicros() - us;
+        us = testMicros();
+        for (uint16_t n = 0; n < test_count; n++) sink += user_thermistor_to_deg_c(i, lo + uint32_t(n) * span / test_count);
+        const uint32_t table_us = testMicros() - us;
+
+        countTestFailures(failures);
+        SERIAL_ECHOPGM("Thermistor table P", i, ": ", user_thermistor_table_len[i], " entries, raw ", lo, "-", hi);
+        SERIAL_ECHOPAIR_F(", max error ", max_error, 2);
+        SERIAL_ECHOLNPGM("C, ", failures, " out of tolerance, ", table_us, "us (equation ", equation_us, "us)");
+      }
+    }
+
+  #endif
+
+#endif // HAS_USER_THERMISTORS
 
 #if HAS_HOTEND
   // Derived from RepRap FiveD extruder::getTemperature()
@@ -2630,7 +2803,7 @@ void Temperature::updateTemperaturesFromRawValues() {
 
       const bool heater_on = temp_hotend[e].target > 0;
       if (heater_on && !is_hotend_preheating(e) && ((neg && r > temp_range[e].raw_min) || (pos && r < temp_range[e].raw_min))) {
-        if (TERN1(MULTI_MAX_CONSECUTIVE_LOW_TEMP_ERR, ++consecutive_low_temperature_error[e] >= MAX_CONSECUTIVE_LOW_TEMPERATURE_ERROR_ALLOWED))
+        if (TERN1(MULTI_MAX_CONSECUTIVE_LOW_TEMP_ERR, ++consecutive_low_temperature_error[e] >= LOW_TEMP_ERRORS_ALLOWED))
           mintemp_error((heater_id_t)e);
       }
       else {
@@ -3517,6 +3690,30 @@ void Temperature::readings_ready() {
 
   // Update raw values only if they're not already set.
   if (!raw_temps_ready) {
+    #if ENABLED(ADC_DMA_RING)
+      // Each ring sum adds up OVERSAMPLENR samples, the same scale as the ISR accumulators
+      static_assert(HAL_ADC_RING_DEPTH == OVERSAMPLENR, "HAL_ADC_RING_DEPTH must equal OVERSAMPLENR.");
+      #define RING_SAMPLE(obj, PIN) obj.sample(hal.adc_ring_sum(PIN))
+      TERN_(HAS_TEMP_ADC_0,         RING_SAMPLE(temp_hotend[0], TEMP_0_PIN));
+      TERN_(HAS_TEMP_ADC_1,         RING_SAMPLE(temp_hotend[1], TEMP_1_PIN));
+      TERN_(HAS_TEMP_ADC_2,         RING_SAMPLE(temp_hotend[2], TEMP_2_PIN));
+      TERN_(HAS_TEMP_ADC_3,         RING_SAMPLE(temp_hotend[3], TEMP_3_PIN));
+      TERN_(HAS_TEMP_ADC_4,         RING_SAMPLE(temp_hotend[4], TEMP_4_PIN));
+      TERN_(HAS_TEMP_ADC_5,         RING_SAMPLE(temp_hotend[5], TEMP_5_PIN));
+      TERN_(HAS_TEMP_ADC_6,         RING_SAMPLE(temp_hotend[6], TEMP_6_PIN));
+      TERN_(HAS_TEMP_ADC_7,         RING_SAMPLE(temp_hotend[7], TEMP_7_PIN));
+      TERN_(HAS_TEMP_ADC_BED,       RING_SAMPLE(temp_bed, TEMP_BED_PIN));
+      TERN_(HAS_TEMP_ADC_CHAMBER,   RING_SAMPLE(temp_chamber, TEMP_CHAMBER_PIN));
+      TERN_(HAS_TEMP_ADC_COOLER,    RING_SAMPLE(temp_cooler, TEMP_COOLER_PIN));
+      TERN_(HAS_TEMP_ADC_PROBE,     RING_SAMPLE(temp_probe, TEMP_PROBE_PIN));
+      TERN_(HAS_TEMP_ADC_BOARD,     RING_SAMPLE(temp_board, TEMP_BOARD_PIN));
+      TERN_(HAS_TEMP_ADC_SOC,       RING_SAMPLE(temp_soc, TEMP_SOC_PIN));
+      TERN_(HAS_TEMP_ADC_REDUNDANT, RING_SAMPLE(temp_redundant, TEMP_REDUNDANT_PIN));
+      TERN_(HAS_JOY_ADC_X,          RING_SAMPLE(joystick.x, JOY_X_PIN));
+      TERN_(HAS_JOY_ADC_Y,          RING_SAMPLE(joystick.y, JOY_Y_PIN));
+      TERN_(HAS_JOY_ADC_Z,          RING_SAMPLE(joystick.z, JOY_Z_PIN));
+      #undef RING_SAMPLE
+    #endif
     update_raw_temperatures();
     raw_temps_ready = true;
   }
@@ -3598,6 +3795,7 @@ public:
  *  - Advance Babysteps
  *  - Endstop polling
  *  - Planner clean buffer
+ *  - Fixed-time Motion stepper commands (FTM_TIMER_TASK)
  */
 void Temperature::isr() {
 
@@ -3625,15 +3823,15 @@ void Temperature::isr() {
     static bool ADCKey_pressed = false;
   #endif
 
-  #if HAS_HOTEND
+  #if HAS_HOTEND && !HAS_POWER_BUDGET
     static SoftPWM soft_pwm_hotend[HOTENDS];
   #endif
 
-  #if HAS_HEATED_BED
+  #if HAS_HEATED_BED && !HAS_POWER_BUDGET
     static SoftPWM soft_pwm_bed;
   #endif
 
-  #if HAS_HEATED_CHAMBER
+  #if HAS_HEATED_CHAMBER && !HAS_POWER_BUDGET
     static SoftPWM soft_pwm_chamber;
   #endif
 
@@ -3649,7 +3847,7 @@ void Temperature::isr() {
 
   #if DISABLED(SLOW_PWM_HEATERS)
 
-    #if ANY(HAS_HOTEND, HAS_HEATED_BED, HAS_HEATED_CHAMBER, HAS_COOLER, FAN_SOFT_PWM)
+    #if ANY(HAS_COOLER, FAN_SOFT_PWM) || (!HAS_POWER_BUDGET && ANY(HAS_HOTEND, HAS_HEATED_BED, HAS_HEATED_CHAMBER))
       constexpr uint8_t pwm_mask = TERN0(SOFT_PWM_DITHER, _BV(SOFT_PWM_SCALE) - 1);
       #define _PWM_MOD(N,S,T) do{                           \
         const bool on = S.add(pwm_mask, T.soft_pwm_amount); \
@@ -3663,16 +3861,16 @@ void Temperature::isr() {
     if (pwm_count_tmp >= 127) {
       pwm_count_tmp -= 127;
 
-      #if HAS_HOTEND
+      #if HAS_HOTEND && !HAS_POWER_BUDGET
         #define _PWM_MOD_E(N) _PWM_MOD(N,soft_pwm_hotend[N],temp_hotend[N]);
         REPEAT(HOTENDS, _PWM_MOD_E);
       #endif
 
-      #if HAS_HEATED_BED
+      #if HAS_HEATED_BED && !HAS_POWER_BUDGET
         _PWM_MOD(BED, soft_pwm_bed, temp_bed);
       #endif
 
-      #if HAS_HEATED_CHAMBER
+      #if HAS_HEATED_CHAMBER && !HAS_POWER_BUDGET
         _PWM_MOD(CHAMBER, soft_pwm_chamber, temp_chamber);
       #endif
 
@@ -3720,16 +3918,16 @@ void Temperature::isr() {
     }
     else {
       #define _PWM_LOW(N,S) do{ if (S.count <= pwm_count_tmp) WRITE_HEATER_##N(LOW); }while(0)
-      #if HAS_HOTEND
+      #if HAS_HOTEND && !HAS_POWER_BUDGET
         #define _PWM_LOW_E(N) _PWM_LOW(N, soft_pwm_hotend[N]);
         REPEAT(HOTENDS, _PWM_LOW_E);
       #endif
 
-      #if HAS_HEATED_BED
+      #if HAS_HEATED_BED && !HAS_POWER_BUDGET
         _PWM_LOW(BED, soft_pwm_bed);
       #endif
 
-      #if HAS_HEATED_CHAMBER
+      #if HAS_HEATED_CHAMBER && !HAS_POWER_BUDGET
         _PWM_LOW(CHAMBER, soft_pwm_chamber);
       #endif
 
@@ -3768,6 +3966,21 @@ void Temperature::isr() {
       #endif
     }
 
+    #if HAS_POWER_BUDGET
+      // Each heater is on for its granted count, starting at its own phase of the cycle
+      #define _PWM_SLICE(N,I,T) WRITE_HEATER_##N(power_budget.is_on(I, pwm_count_tmp, T.soft_pwm_amount))
+      #if HAS_HOTEND
+        #define _PWM_SLICE_E(N) _PWM_SLICE(N, N, temp_hotend[N]);
+        REPEAT(HOTENDS, _PWM_SLICE_E);
+      #endif
+      #if HAS_HEATED_BED
+        _PWM_SLICE(BED, POWER_BUDGET_BED, temp_bed);
+      #endif
+      #if HAS_HEATED_CHAMBER
+        _PWM_SLICE(CHAMBER, POWER_BUDGET_CHAMBER, temp_chamber);
+      #endif
+    #endif
+
     // SOFT_PWM_SCALE to frequency:
     //
     // 0: 16000000/64/256/128 =   7.6294 Hz
@@ -3960,86 +4173,90 @@ void Temperature::isr() {
     #pragma GCC diagnostic pop
 
     case StartSampling:                                   // Start of sampling loops. Do updates/checks.
-      if (++temp_count >= OVERSAMPLENR) {                 // 10 * 16 * 1/(16000000/64/256)  = 164ms.
+      if (++temp_count >= TEMP_UPDATE_LOOPS) {            // 10 * 16 * 1/(16000000/64/256)  = 164ms.
         temp_count = 0;
         readings_ready();
       }
       break;
 
-    #if HAS_TEMP_ADC_0
-      case PrepareTemp_0: hal.adc_start(TEMP_0_PIN); break;
-      case MeasureTemp_0: ACCUMULATE_ADC(temp_hotend[0]); break;
-    #endif
+    #if DISABLED(ADC_DMA_RING)
 
-    #if HAS_TEMP_ADC_BED
-      case PrepareTemp_BED: hal.adc_start(TEMP_BED_PIN); break;
-      case MeasureTemp_BED: ACCUMULATE_ADC(temp_bed); break;
-    #endif
+      #if HAS_TEMP_ADC_0
+        case PrepareTemp_0: hal.adc_start(TEMP_0_PIN); break;
+        case MeasureTemp_0: ACCUMULATE_ADC(temp_hotend[0]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_CHAMBER
-      case PrepareTemp_CHAMBER: hal.adc_start(TEMP_CHAMBER_PIN); break;
-      case MeasureTemp_CHAMBER: ACCUMULATE_ADC(temp_chamber); break;
-    #endif
+      #if HAS_TEMP_ADC_BED
+        case PrepareTemp_BED: hal.adc_start(TEMP_BED_PIN); break;
+        case MeasureTemp_BED: ACCUMULATE_ADC(temp_bed); break;
+      #endif
 
-    #if HAS_TEMP_ADC_COOLER
-      case PrepareTemp_COOLER: hal.adc_start(TEMP_COOLER_PIN); break;
-      case MeasureTemp_COOLER: ACCUMULATE_ADC(temp_cooler); break;
-    #endif
+      #if HAS_TEMP_ADC_CHAMBER
+        case PrepareTemp_CHAMBER: hal.adc_start(TEMP_CHAMBER_PIN); break;
+        case MeasureTemp_CHAMBER: ACCUMULATE_ADC(temp_chamber); break;
+      #endif
 
-    #if HAS_TEMP_ADC_PROBE
-      case PrepareTemp_PROBE: hal.adc_start(TEMP_PROBE_PIN); break;
-      case MeasureTemp_PROBE: ACCUMULATE_ADC(temp_probe); break;
-    #endif
+      #if HAS_TEMP_ADC_COOLER
+        case PrepareTemp_COOLER: hal.adc_start(TEMP_COOLER_PIN); break;
+        case MeasureTemp_COOLER: ACCUMULATE_ADC(temp_cooler); break;
+      #endif
 
-    #if HAS_TEMP_ADC_BOARD
-      case PrepareTemp_BOARD: hal.adc_start(TEMP_BOARD_PIN); break;
-      case MeasureTemp_BOARD: ACCUMULATE_ADC(temp_board); break;
-    #endif
+      #if HAS_TEMP_ADC_PROBE
+        case PrepareTemp_PROBE: hal.adc_start(TEMP_PROBE_PIN); break;
+        case MeasureTemp_PROBE: ACCUMULATE_ADC(temp_probe); break;
+      #endif
 
-    #if HAS_TEMP_ADC_SOC
-      case PrepareTemp_SOC: hal.adc_start(TEMP_SOC_PIN); break;
-      case MeasureTemp_SOC: ACCUMULATE_ADC(temp_soc); break;
-    #endif
+      #if HAS_TEMP_ADC_BOARD
+        case PrepareTemp_BOARD: hal.adc_start(TEMP_BOARD_PIN); break;
+        case MeasureTemp_BOARD: ACCUMULATE_ADC(temp_board); break;
+      #endif
 
-    #if HAS_TEMP_ADC_REDUNDANT
-      case PrepareTemp_REDUNDANT: hal.adc_start(TEMP_REDUNDANT_PIN); break;
-      case MeasureTemp_REDUNDANT: ACCUMULATE_ADC(temp_redundant); break;
-    #endif
+      #if HAS_TEMP_ADC_SOC
+        case PrepareTemp_SOC: hal.adc_start(TEMP_SOC_PIN); break;
+        case MeasureTemp_SOC: ACCUMULATE_ADC(temp_soc); break;
+      #endif
 
-    #if HAS_TEMP_ADC_1
-      case PrepareTemp_1: hal.adc_start(TEMP_1_PIN); break;
-      case MeasureTemp_1: ACCUMULATE_ADC(temp_hotend[1]); break;
-    #endif
+      #if HAS_TEMP_ADC_REDUNDANT
+        case PrepareTemp_REDUNDANT: hal.adc_start(TEMP_REDUNDANT_PIN); break;
+        case MeasureTemp_REDUNDANT: ACCUMULATE_ADC(temp_redundant); break;
+      #endif
 
-    #if HAS_TEMP_ADC_2
-      case PrepareTemp_2: hal.adc_start(TEMP_2_PIN); break;
-      case MeasureTemp_2: ACCUMULATE_ADC(temp_hotend[2]); break;
-    #endif
+      #if HAS_TEMP_ADC_1
+        case PrepareTemp_1: hal.adc_start(TEMP_1_PIN); break;
+        case MeasureTemp_1: ACCUMULATE_ADC(temp_hotend[1]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_3
-      case PrepareTemp_3: hal.adc_start(TEMP_3_PIN); break;
-      case MeasureTemp_3: ACCUMULATE_ADC(temp_hotend[3]); break;
-    #endif
+      #if HAS_TEMP_ADC_2
+        case PrepareTemp_2: hal.adc_start(TEMP_2_PIN); break;
+        case MeasureTemp_2: ACCUMULATE_ADC(temp_hotend[2]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_4
-      case PrepareTemp_4: hal.adc_start(TEMP_4_PIN); break;
-      case MeasureTemp_4: ACCUMULATE_ADC(temp_hotend[4]); break;
-    #endif
+      #if HAS_TEMP_ADC_3
+        case PrepareTemp_3: hal.adc_start(TEMP_3_PIN); break;
+        case MeasureTemp_3: ACCUMULATE_ADC(temp_hotend[3]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_5
-      case PrepareTemp_5: hal.adc_start(TEMP_5_PIN); break;
-      case MeasureTemp_5: ACCUMULATE_ADC(temp_hotend[5]); break;
-    #endif
+      #if HAS_TEMP_ADC_4
+        case PrepareTemp_4: hal.adc_start(TEMP_4_PIN); break;
+        case MeasureTemp_4: ACCUMULATE_ADC(temp_hotend[4]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_6
-      case PrepareTemp_6: hal.adc_start(TEMP_6_PIN); break;
-      case MeasureTemp_6: ACCUMULATE_ADC(temp_hotend[6]); break;
-    #endif
+      #if HAS_TEMP_ADC_5
+        case PrepareTemp_5: hal.adc_start(TEMP_5_PIN); break;
+        case MeasureTemp_5: ACCUMULATE_ADC(temp_hotend[5]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_7
-      case PrepareTemp_7: hal.adc_start(TEMP_7_PIN); break;
-      case MeasureTemp_7: ACCUMULATE_ADC(temp_hotend[7]); break;
-    #endif
+      #if HAS_TEMP_ADC_6
+        case PrepareTemp_6: hal.adc_start(TEMP_6_PIN); break;
+        case MeasureTemp_6: ACCUMULATE_ADC(temp_hotend[6]); break;
+      #endif
+
+      #if HAS_TEMP_ADC_7
+        case PrepareTemp_7: hal.adc_start(TEMP_7_PIN); break;
+        case MeasureTemp_7: ACCUMULATE_ADC(temp_hotend[7]); break;
+      #endif
+
+    #endif // !ADC_DMA_RING
 
     #if ENABLED(FILAMENT_WIDTH_SENSOR)
       case Prepare_FILWIDTH: hal.adc_start(FILWIDTH_PIN); break;
@@ -4069,19 +4286,23 @@ void Temperature::isr() {
         break;
     #endif
 
-    #if HAS_JOY_ADC_X
-      case PrepareJoy_X: hal.adc_start(JOY_X_PIN); break;
-      case MeasureJoy_X: ACCUMULATE_ADC(joystick.x); break;
-    #endif
+    #if DISABLED(ADC_DMA_RING)
 
-    #if HAS_JOY_ADC_Y
-      case PrepareJoy_Y: hal.adc_start(JOY_Y_PIN); break;
-      case MeasureJoy_Y: ACCUMULATE_ADC(joystick.y); break;
-    #endif
+      #if HAS_JOY_ADC_X
+        case PrepareJoy_X: hal.adc_start(JOY_X_PIN); break;
+        case MeasureJoy_X: ACCUMULATE_ADC(joystick.x); break;
+      #endif
+
+      #if HAS_JOY_ADC_Y
+        case PrepareJoy_Y: hal.adc_start(JOY_Y_PIN); break;
+        case MeasureJoy_Y: ACCUMULATE_ADC(joystick.y); break;
+      #endif
+
+      #if HAS_JOY_ADC_Z
+        case PrepareJoy_Z: hal.adc_start(JOY_Z_PIN); break;
+        case MeasureJoy_Z: ACCUMULATE_ADC(joystick.z); break;
+      #endif
 
-    #if HAS_JOY_ADC_Z
-      case PrepareJoy_Z: hal.adc_start(JOY_Z_PIN); break;
-      case MeasureJoy_Z: ACCUMULATE_ADC(joystick.z); break;
     #endif
 
     #if HAS_ADC_BUTTONS
@@ -4133,6 +4354,11 @@ void Temperature::isr() {
 
   // Periodically call the planner timer service routine
   planner.isr();
+
+  // Generate Fixed-time Motion stepper commands, unless the main loop is changing the controller state
+  #if ENABLED(FTM_TIMER_TASK)
+    if (!fxdTiCtrl.taskHeld) fxdTiCtrl.loop();
+  #endif
 }
 
 #if HAS_TEMP_SENSOR
@@ -4246,6 +4472,7 @@ void Temperature::isr() {
         SERIAL_ECHO(getHeaterPower((heater_id_t)e));
       }
     #endif
+    TERN_(HAS_POWER_BUDGET, power_budget.report());
   }
 
   #if ENABLED(AUTO_REPORT_TEMPERATURES)
@@ -73,59 +73,61 @@ typedef enum : int_fast8_t {
  */
 enum ADCSensorState : char {
   StartSampling,
-  #if HAS_TEMP_ADC_0
-    PrepareTemp_0, MeasureTemp_0,
-  #endif
-  #if HAS_TEMP_ADC_BED
-    PrepareTemp_BED, MeasureTemp_BED,
-  #endif
-  #if HAS_TEMP_ADC_CHAMBER
-    PrepareTemp_CHAMBER, MeasureTemp_CHAMBER,
-  #endif
-  #if HAS_TEMP_ADC_COOLER
-    PrepareTemp_COOLER, MeasureTemp_COOLER,
-  #endif
-  #if HAS_TEMP_ADC_PROBE
-    PrepareTemp_PROBE, MeasureTemp_PROBE,
-  #endif
-  #if HAS_TEMP_ADC_BOARD
-    PrepareTemp_BOARD, MeasureTemp_BOARD,
-  #endif
-  #if HAS_TEMP_ADC_SOC
-    PrepareTemp_SOC, MeasureTemp_SOC,
-  #endif
-  #if HAS_TEMP_ADC_REDUNDANT
-    PrepareTemp_REDUNDANT, MeasureTemp_REDUNDANT,
-  #endif
-  #if HAS_TEMP_ADC_1
-    PrepareTemp_1, MeasureTemp_1,
-  #endif
-  #if HAS_TEMP_ADC_2
-    PrepareTemp_2, MeasureTemp_2,
-  #endif
-  #if HAS_TEMP_ADC_3
-    PrepareTemp_3, MeasureTemp_3,
-  #endif
-  #if HAS_TEMP_ADC_4
-    PrepareTemp_4, MeasureTemp_4,
-  #endif
-  #if HAS_TEMP_ADC_5
-    PrepareTemp_5, MeasureTemp_5,
-  #endif
-  #if HAS_TEMP_ADC_6
-    PrepareTemp_6, MeasureTemp_6,
-  #endif
-  #if HAS_TEMP_ADC_7
-    PrepareTemp_7, MeasureTemp_7,
-  #endif
-  #if HAS_JOY_ADC_X
-    PrepareJoy_X, MeasureJoy_X,
-  #endif
-  #if HAS_JOY_ADC_Y
-    PrepareJoy_Y, MeasureJoy_Y,
-  #endif
-  #if HAS_JOY_ADC_Z
-    PrepareJoy_Z, MeasureJoy_Z,
+  #if DISABLED(ADC_DMA_RING) // Otherwise the HAL samples these in the background
+    #if HAS_TEMP_ADC_0
+      PrepareTemp_0, MeasureTemp_0,
+    #endif
+    #if HAS_TEMP_ADC_BED
+      PrepareTemp_BED, MeasureTemp_BED,
+    #endif
+    #if HAS_TEMP_ADC_CHAMBER
+      PrepareTemp_CHAMBER, MeasureTemp_CHAMBER,
+    #endif
+    #if HAS_TEMP_ADC_COOLER
+      PrepareTemp_COOLER, MeasureTemp_COOLER,
+    #endif
+    #if HAS_TEMP_ADC_PROBE
+      PrepareTemp_PROBE, MeasureTemp_PROBE,
+    #endif
+    #if HAS_TEMP_ADC_BOARD
+      PrepareTemp_BOARD, MeasureTemp_BOARD,
+    #endif
+    #if HAS_TEMP_ADC_SOC
+      PrepareTemp_SOC, MeasureTemp_SOC,
+    #endif
+    #if HAS_TEMP_ADC_REDUNDANT
+      PrepareTemp_REDUNDANT, MeasureTemp_REDUNDANT,
+    #endif
+    #if HAS_TEMP_ADC_1
+      PrepareTemp_1, MeasureTemp_1,
+    #endif
+    #if HAS_TEMP_ADC_2
+      PrepareTemp_2, MeasureTemp_2,
+    #endif
+    #if HAS_TEMP_ADC_3
+      PrepareTemp_3, MeasureTemp_3,
+    #endif
+    #if HAS_TEMP_ADC_4
+      PrepareTemp_4, MeasureTemp_4,
+    #endif
+    #if HAS_TEMP_ADC_5
+      PrepareTemp_5, MeasureTemp_5,
+    #endif
+    #if HAS_TEMP_ADC_6
+      PrepareTemp_6, MeasureTemp_6,
+    #endif
+    #if HAS_TEMP_ADC_7
+      PrepareTemp_7, MeasureTemp_7,
+    #endif
+    #if HAS_JOY_ADC_X
+      PrepareJoy_X, MeasureJoy_X,
+    #endif
+    #if HAS_JOY_ADC_Y
+      PrepareJoy_Y, MeasureJoy_Y,
+    #endif
+    #if HAS_JOY_ADC_Z
+      PrepareJoy_Z, MeasureJoy_Z,
+    #endif
   #endif
   #if ENABLED(FILAMENT_WIDTH_SENSOR)
     Prepare_FILWIDTH, Measure_FILWIDTH,
@@ -146,12 +148,19 @@ enum ADCSensorState : char {
 };
 
 // Minimum number of Temperature::ISR loops between sensor readings.
-// Multiplied by 16 (OVERSAMPLENR) to obtain the total time to
+// Multiplied by TEMP_UPDATE_LOOPS to obtain the total time to
 // get all oversampled sensor readings
 #define MIN_ADC_ISR_LOOPS 10
 
 #define ACTUAL_ADC_SAMPLES _MAX(int(MIN_ADC_ISR_LOOPS), int(SensorsReady))
 
+// Sensor rounds per temperature update. A DMA ring already holds OVERSAMPLENR samples of each sensor.
+#define TEMP_UPDATE_LOOPS TERN(ADC_DMA_RING, ADC_RING_UPDATE_LOOPS, OVERSAMPLENR)
+
+// Classic (OVERSAMPLENR round) update periods per temperature update. Smoothing factors
+// and error counts that act once per update are given for the classic rate.
+#define TEMP_UPDATE_SCALE (float(TEMP_UPDATE_LOOPS) / (OVERSAMPLENR))
+
 //
 // PID
 //
@@ -161,8 +170,9 @@ typedef struct { float p, i, d, c, f; } raw_pidcf_t;
 
 #if HAS_PID_HEATING
 
-  #define PID_K2 (1.0f - float(PID_K1))
-  #define PID_dT ((OVERSAMPLENR * float(ACTUAL_ADC_SAMPLES)) / (TEMP_TIMER_FREQUENCY))
+  // Keep the D term smoothing time the same at a faster update rate
+  #define PID_K2 (1.0f - TERN(ADC_DMA_RING, powf(float(PID_K1), TEMP_UPDATE_SCALE), float(PID_K1)))
+  #define PID_dT ((TEMP_UPDATE_LOOPS * float(ACTUAL_ADC_SAMPLES)) / (TEMP_TIMER_FREQUENCY))
 
   // Apply the scale factors to the PID values
   #define scalePID_i(i)   ( float(i) * PID_dT )
@@ -211,7 +221,8 @@ typedef struct { float p, i, d, c, f; } raw_pidcf_t;
 
     float get_extrusion_scale_output(const bool, const int32_t, const float, const int16_t) { return 0; }
 
-    float get_pid_output(const float target, const float current) {
+    // With 'hold_i' the integral is left as-is, so it doesn't wind up while the output can't be applied
+    float get_pid_output(const float target, const float current, const bool hold_i=false) {
       const float pid_error = target - current;
       if (!target || pid_error < -(PID_FUNCTIONAL_RANGE)) {
         pid_reset = true;
@@ -229,7 +240,7 @@ typedef struct { float p, i, d, c, f; } raw_pidcf_t;
       }
 
       const float max_power_over_i_gain = float(MAX_POW) / Ki - float(MIN_POW);
-      temp_iState = constrain(temp_iState + pid_error, 0, max_power_over_i_gain);
+      if (!hold_i) temp_iState = constrain(temp_iState + pid_error, 0, max_power_over_i_gain);
 
       work_p = Kp * pid_error;
       work_i = Ki * temp_iState;
@@ -405,7 +416,10 @@ typedef struct { float p, i, d, c, f; } raw_pidcf_t;
     float fanCoefficient() { return SUM_TERN(MPC_INCLUDE_FAN, ambient_xfer_coeff_fan0, fan255_adjustment); }
   } MPC_t;
 
-  #define MPC_dT ((OVERSAMPLENR * float(ACTUAL_ADC_SAMPLES)) / (TEMP_TIMER_FREQUENCY))
+  #define MPC_dT ((TEMP_UPDATE_LOOPS * float(ACTUAL_ADC_SAMPLES)) / (TEMP_TIMER_FREQUENCY))
+
+  // Share of the sensor error applied to the model at each update, for the same settling time at any rate
+  #define MPC_SMOOTHING TERN(ADC_DMA_RING, (1.0f - powf(1.0f - float(MPC_SMOOTHING_FACTOR), TEMP_UPDATE_SCALE)), float(MPC_SMOOTHING_FACTOR))
 
 #endif
 
@@ -776,7 +790,7 @@ class Temperature {
     #endif
 
     #if MAX_CONSECUTIVE_LOW_TEMPERATURE_ERROR_ALLOWED > 1
-      static uint8_t consecutive_low_temperature_error[HOTENDS];
+      static TERN(ADC_DMA_RING, uint16_t, uint8_t) consecutive_low_temperature_error[HOTENDS];
     #endif
 
     #if HAS_FAN_LOGIC
@@ -822,11 +836,20 @@ class Temperature {
       static user_thermistor_t user_thermistor[USER_THERMISTORS];
       static void M305_report(const uint8_t t_index, const bool forReplay=true);
       static void reset_user_thermistors();
+      static void update_user_thermistor(const uint8_t t_index);
       static celsius_float_t user_thermistor_to_deg_c(const uint8_t t_index, const raw_adc_t raw);
+      #if HAS_USER_THERMISTOR_TABLE
+        static temp_entry_t user_thermistor_table[USER_THERMISTORS][USER_THERMISTOR_TABLE_SIZE];
+        static uint8_t user_thermistor_table_len[USER_THERMISTORS];
+        #if ENABLED(MARLIN_TEST_BUILD)
+          static void test_user_thermistor_tables();
+        #endif
+      #endif
       static bool set_pull_up_res(int8_t t_index, float value) {
         //if (!WITHIN(t_index, 0, USER_THERMISTORS - 1)) return false;
         if (!WITHIN(value, 1, 1000000)) return false;
         user_thermistor[t_index].series_res = value;
+        TERN_(HAS_USER_THERMISTOR_TABLE, user_thermistor[t_index].pre_calc = true);
         return true;
       }
       static bool set_res25(int8_t t_index, float value) {
@@ -1417,6 +1417,48 @@ int16_t SdBaseFile::read(void * const buf, uint16_t nbyte) {
   return nbyte;
 }
 
+/**
+ * Read whole blocks from a file starting at the current position,
+ * which must be at the start of a block.
+ *
+ * Blocks are read straight into \a dst without going through the volume
+ * cache, so other file system access can't evict them. Consecutive blocks
+ * within the current cluster are read with a single multiple block read.
+ *
+ * \param[out] dst Pointer to a buffer of at least \a maxBlocks * 512 bytes.
+ *
+ * \param[in] maxBlocks Maximum number of blocks to read.
+ *
+ * \return The number of blocks read, which may be fewer than \a maxBlocks
+ * at the end of a cluster. Zero at end of file, or -1 on error.
+ */
+int16_t SdBaseFile::readBlocks(uint8_t * const dst, const uint8_t maxBlocks) {
+  if (!isFile() || !(flags_ & O_READ)) return -1;
+  if (curPosition_ >= fileSize_ || !maxBlocks) return 0;
+  if (curPosition_ & 0x1FF) return -1;
+
+  const uint8_t blockOfCluster = vol_->blockOfCluster(curPosition_);
+  if (blockOfCluster == 0) {
+    // start of new cluster
+    if (curPosition_ == 0)
+      curCluster_ = firstCluster_;                      // use first cluster in file
+    else if (!vol_->fatGet(curCluster_, &curCluster_))  // get next cluster from FAT
+      return -1;
+  }
+  const uint32_t block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
+
+  uint8_t count = _MIN(maxBlocks, vol_->blocksPerCluster() - blockOfCluster);
+  NOMORE(count, (fileSize_ - curPosition_ + 511) >> 9);
+
+  // Write back the cache first if it holds one of these blocks
+  if (vol_->cacheBlockNumber() - block < count && !vol_->cacheFlush()) return -1;
+
+  if (!vol_->readBlocks(block, dst, count)) return -1;
+
+  curPosition_ = _MIN(curPosition_ + (uint32_t(count) << 9), fileSize_);
+  return count;
+}
+
 /**
  * Read the next entry in a directory.
  *
@@ -297,6 +297,7 @@ class SdBaseFile {
   bool printName();
   int16_t read();
   int16_t read(void * const buf, uint16_t nbyte);
+  int16_t readBlocks(uint8_t * const dst, const uint8_t maxBlocks);
   int8_t readDir(dir_t * const dir, char * const longFilename);
   static bool remove(SdBaseFile * const dirFile, const char * const path);
   bool remove();
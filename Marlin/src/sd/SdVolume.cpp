@@ -148,6 +148,16 @@ bool SdVolume::cacheRawBlock(const uint32_t blockNumber, const bool dirty) {
   return true;
 }
 
+// read consecutive blocks. SPI cards use one multiple block read (CMD18).
+// The SDIO and USB drivers still read them one block at a time.
+bool SdVolume::readBlocks(const uint32_t block, uint8_t *dst, const uint8_t count) {
+  if (count == 1) return readBlock(block, dst);
+  if (!sdCard_->readStart(block)) return false;
+  for (uint8_t i = 0; i < count; ++i, dst += 512)
+    if (!sdCard_->readData(dst)) { sdCard_->readStop(); return false; }
+  return sdCard_->readStop();
+}
+
 // return the size in bytes of a cluster chain
 bool SdVolume::chainSize(uint32_t cluster, uint32_t * const size) {
   uint32_t s = 0;
@@ -197,6 +197,7 @@ class SdVolume {
     return cluster >= FAT32EOC_MIN;
   }
   bool readBlock(const uint32_t block, uint8_t * const dst) { return sdCard_->readBlock(block, dst); }
+  bool readBlocks(const uint32_t block, uint8_t *dst, const uint8_t count);
   bool writeBlock(const uint32_t block, const uint8_t * const dst) { return sdCard_->writeBlock(block, dst); }
 };
 
@@ -148,6 +148,19 @@ MediaFile CardReader::file;
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#if HAS_SD_READ_AHEAD
+  __attribute__((aligned(sizeof(size_t)))) uint8_t CardReader::ra_buffer[SD_READ_AHEAD_BLOCKS][512];
+  uint32_t CardReader::ra_block, CardReader::ra_pos;
+  uint8_t CardReader::ra_head, CardReader::ra_count;
+  CardReader::read_ahead_stats_t CardReader::ra_stats;
+#endif
+
+#if ENABLED(HEATSHRINK_GCODE)
+  heatshrink_decoder CardReader::hsd;
+  uint8_t CardReader::hs_buffer[HEATSHRINK_STATIC_INPUT_BUFFER_SIZE], CardReader::hs_index, CardReader::hs_count;
+  bool CardReader::hs_done, CardReader::hs_error;
+#endif
+
 CardReader::CardReader() {
   changeMedia(&
     #if HAS_USB_FLASH_DRIVE && !SHARED_VOLUME_IS(SD_ONBOARD)
@@ -167,6 +180,7 @@ CardReader::CardReader() {
   #endif
 
   flag.sdprinting = flag.sdprintdone = flag.mounted = flag.saving = flag.logging = false;
+  TERN_(HEATSHRINK_GCODE, flag.compressed = false);
   filesize = sdpos = 0;
 
   TERN_(HAS_MEDIA_SUBCALLS, file_subcall_ctr = 0);
@@ -226,6 +240,11 @@ bool CardReader::is_visible_entity(const dir_t &p OPTARG(CUSTOM_FIRMWARE_UPLOAD,
     || fileIsBinary()                                   // BIN files are accepted
     || (!onlyBin && p.name[8] == 'G'
                  && p.name[9] != '~')                   // Non-backup *.G* files are accepted
+    #if ENABLED(HEATSHRINK_GCODE)
+      || (!onlyBin && p.name[8] == 'H'
+                   && p.name[9] == 'S'
+                   && p.name[10]== ' ')                 // Compressed *.HS files are accepted
+    #endif
   );
 }
 
@@ -730,6 +749,14 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
   if (file.open(diveDir, fname, O_READ)) {
     filesize = file.fileSize();
     sdpos = 0;
+    TERN_(HAS_SD_READ_AHEAD, ra_reset());
+
+    #if ENABLED(HEATSHRINK_GCODE)
+      char dosname[FILENAME_LENGTH];
+      const char * const ext = file.getDosName(dosname) ? strrchr(dosname, '.') : nullptr;
+      flag.compressed = ext && strcmp_P(ext, PSTR(".HS")) == 0;
+      if (flag.compressed) hs_reset();
+    #endif
 
     { // Don't remove this block, as the PORT_REDIRECT is a RAII
       PORT_REDIRECT(SerialMask::All);
@@ -744,6 +771,242 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
     openFailed(fname);
 }
 
+#if ENABLED(HEATSHRINK_GCODE)
+
+  //
+  // Restart decoding from the beginning of the compressed file
+  //
+  #if ENABLED(MARLIN_TEST_BUILD)
+    // test_heatshrink() reads compressed data from memory in place of the media
+    static const uint8_t *hs_test_data;
+    static int16_t hs_test_size, hs_test_pos, hs_test_fail_at;
+  #endif
+
+  void CardReader::hs_reset() {
+    heatshrink_decoder_reset(&hsd);
+    hs_index = hs_count = 0;
+    hs_done = hs_error = false;
+    sdpos = 0;
+    #if ENABLED(MARLIN_TEST_BUILD)
+      if (hs_test_data) { hs_test_pos = 0; return; }
+    #endif
+    TERN(HAS_SD_READ_AHEAD, ra_seek, file.seekSet)(0);
+  }
+
+  int16_t CardReader::hs_read(uint8_t *buf, const uint16_t nbyte) {
+    #if ENABLED(MARLIN_TEST_BUILD)
+      if (hs_test_data) {
+        if (hs_test_pos >= hs_test_fail_at) return -1;
+        const int16_t nr = _MIN(int16_t(nbyte), hs_test_size - hs_test_pos);
+        memcpy(buf, &hs_test_data[hs_test_pos], nr);
+        hs_test_pos += nr;
+        return nr;
+      }
+    #endif
+    return TERN(HAS_SD_READ_AHEAD, ra_read, file.read)(buf, nbyte);
+  }
+
+  //
+  // Get the next decompressed byte, reading from the media as the decoder needs it.
+  // After a read or decoder error it returns -1 without reaching the end of the file,
+  // so the print is aborted and not taken as finished.
+  //
+  int16_t CardReader::hs_get() {
+    for (;;) {
+      if (hs_index < hs_count) { sdpos++; return hs_buffer[hs_index++]; }
+      if (hs_done || hs_error) return -1;
+
+      size_t count;
+      if (heatshrink_decoder_poll(&hsd, hs_buffer, sizeof(hs_buffer), &count) < 0) break;
+      hs_index = 0;
+      hs_count = count;
+      if (count) continue;
+
+      // The decoder has used all its input, which leaves room for a whole buffer
+      uint8_t in[HEATSHRINK_STATIC_INPUT_BUFFER_SIZE];
+      const int16_t nr = hs_read(in, sizeof(in));
+      if (nr < 0) break;
+      if (nr == 0) { hs_done = true; continue; }
+      if (heatshrink_decoder_sink(&hsd, in, nr, &count) < 0 || count != size_t(nr)) break;
+    }
+    hs_error = true;
+    return -1;
+  }
+
+  //
+  // Seek to a decompressed index by decoding up to it, from the start if going back
+  //
+  void CardReader::hs_seek(const uint32_t index) {
+    if (index < sdpos) hs_reset();
+    while (sdpos < index && hs_get() >= 0) { /* nada */ }
+  }
+
+  #if ENABLED(MARLIN_TEST_BUILD)
+
+    #include "../tests/marlin_tests.h"
+
+    /**
+     * Decode a file made by buildroot/share/scripts/heatshrink_gcode.py and compare it with
+     * the original, then seek back and forth in it. A read error part-way must stop the
+     * decoding without reaching the end of the file.
+     */
+    void CardReader::test_heatshrink() {
+      static const char text[] =
+        "G28\nG1 Z0.2 F600\nG1 X10 Y10 F3000\nG1 X50 Y10 E2.0\nG1 X50 Y50 E4.0\nG1 X10 Y50 E6.0\n"
+        "G1 X10 Y10 E8.0\nG1 Z0.4\nG1 X50 Y10 E10.0\nG1 X50 Y50 E12.0\nG1 X10 Y50 E14.0\n"
+        "G1 X10 Y10 E16.0\nM104 S0\nM140 S0\n";
+      static const uint8_t packed[] = {
+        0xA3, 0xCC, 0xA7, 0x10, 0xAA, 0x3C, 0xC6, 0x41, 0x5A, 0x98, 0x4B, 0xA6, 0x52, 0x0A, 0x34, 0xDA,
+        0x61, 0x30, 0x06, 0x1D, 0x62, 0x63, 0x30, 0x90, 0x56, 0x40, 0x65, 0x46, 0x99, 0x83, 0xC4, 0x20,
+        0xB3, 0x50, 0x82, 0xD1, 0x66, 0x52, 0xE0, 0x7C, 0x80, 0xCA, 0x8B, 0x34, 0x07, 0xB0, 0xC0, 0xC1,
+        0xE7, 0x36, 0x07, 0xD0, 0xBC, 0xE7, 0x00, 0xF5, 0x2E, 0x94, 0xD0, 0x8F, 0x80, 0x31, 0x24, 0x74,
+        0xC4, 0xB2, 0xE4, 0x97, 0x98, 0x96, 0xAC, 0x64, 0x85, 0xB3, 0xA6, 0x82, 0x46, 0x69, 0x20, 0xA9,
+        0x81, 0xCE, 0x68, 0x12, 0x10, 0x39, 0x00
+      };
+      constexpr uint16_t len = sizeof(text) - 1;
+      uint16_t failures = 0;
+
+      const bool was_compressed = flag.compressed;
+      flag.compressed = true;
+      hs_test_data = packed;
+      hs_test_size = sizeof(packed);
+      hs_test_fail_at = hs_test_size + 1;   // Never
+
+      hs_reset();
+      uint16_t n = 0;
+      for (int16_t c; (c = get()) >= 0; ++n) if (n >= len || c != text[n]) ++failures;
+      if (n != len || !eof() || hs_error) ++failures;
+
+      // Back to the third line, then ahead to the last
+      setIndex(17);
+      if (get() != 'G' || get() != '1' || getIndex() != 19) ++failures;
+      setIndex(len - 8);
+      if (get() != 'M' || get() != '1' || eof()) ++failures;
+
+      hs_test_fail_at = 40;
+      hs_reset();
+      for (n = 0; get() >= 0; ++n) { /* nada */ }
+      if (n >= len || eof() || !hs_error) ++failures;
+
+      hs_test_data = nullptr;
+      flag.compressed = was_compressed;
+
+      countTestFailures(failures);
+      SERIAL_ECHOLNPGM("Heatshrink G-code: ", len, " bytes from ", sizeof(packed), ", ", failures, " mismatches");
+    }
+
+  #endif // MARLIN_TEST_BUILD
+
+#endif // HEATSHRINK_GCODE
+
+#if HAS_SD_READ_AHEAD
+
+  //
+  // Empty the ring and clear the statistics for a newly opened file
+  //
+  void CardReader::ra_reset() {
+    ra_block = ra_pos = 0;
+    ra_head = ra_count = 0;
+    ra_stats = {};
+  }
+
+  //
+  // Free the slots holding blocks before the given block. Once the
+  // ring is empty put the file position at the start of the block.
+  //
+  void CardReader::ra_drop(const uint32_t block) {
+    while (ra_count && ra_block != block) {
+      ra_block++;
+      ra_head = (ra_head + 1) % (SD_READ_AHEAD_BLOCKS);
+      ra_count--;
+    }
+    if (!ra_count && ra_block != block) {
+      ra_block = block;
+      file.seekSet(block << 9);
+    }
+  }
+
+  //
+  // Load blocks into all the free slots, with one read per run of
+  // slots, split where the ring wraps or the file changes cluster
+  //
+  void CardReader::ra_fill() {
+    while (ra_count < SD_READ_AHEAD_BLOCKS) {
+      const uint8_t tail = (ra_head + ra_count) % (SD_READ_AHEAD_BLOCKS);
+      const int16_t nr = file.readBlocks(ra_buffer[tail], _MIN(SD_READ_AHEAD_BLOCKS - ra_count, SD_READ_AHEAD_BLOCKS - tail));
+      if (nr <= 0) break;
+      ra_count += nr;
+      ra_stats.reads++;
+      ra_stats.blocks += nr;
+    }
+  }
+
+  //
+  // Get the next byte of the file, waiting for the media if its block isn't loaded yet
+  //
+  int16_t CardReader::ra_get() {
+    if (ra_pos >= filesize) return -1;
+    const uint32_t block = ra_pos >> 9;
+    if (block != ra_block || !ra_count) {
+      ra_drop(block);
+      if (ra_count)
+        ra_stats.hits++;
+      else {
+        ra_stats.misses++;
+        const uint32_t start = micros();
+        ra_fill();
+        const uint32_t stall = micros() - start;
+        ra_stats.stall_us += stall;
+        NOLESS(ra_stats.max_stall_us, stall);
+        if (!ra_count) return -1;
+      }
+    }
+    return ra_buffer[ra_head][ra_pos++ & 0x1FF];
+  }
+
+  int16_t CardReader::ra_read(void *buf, const uint16_t nbyte) {
+    uint8_t *dst = (uint8_t*)buf;
+    uint16_t nr = 0;
+    while (nr < nbyte) {
+      const int16_t c = ra_get();
+      if (c < 0) break;
+      dst[nr++] = c;
+    }
+    return nr;
+  }
+
+  //
+  // Move to a file position, keeping the loaded blocks if it falls within them
+  //
+  void CardReader::ra_seek(const uint32_t pos) {
+    const uint32_t block = pos >> 9;
+    if (block - ra_block >= ra_count) {
+      ra_head = ra_count = 0;
+      ra_block = block;
+      file.seekSet(block << 9);
+    }
+    ra_pos = pos;
+  }
+
+  //
+  // Top up the ring while there is time to spare, such as when the command queue is full
+  //
+  void CardReader::readAhead() {
+    if (!isFileOpen() || ra_pos >= filesize) return;
+    ra_drop(ra_pos >> 9);
+    if (SD_READ_AHEAD_BLOCKS - ra_count >= (SD_READ_AHEAD_BLOCKS) / 2) ra_fill();
+  }
+
+  void CardReader::report_read_ahead() {
+    SERIAL_ECHOLNPGM(
+      "Read-ahead hits:", ra_stats.hits, " misses:", ra_stats.misses,
+      " reads:", ra_stats.reads, " blocks:", ra_stats.blocks,
+      " stall:", ra_stats.stall_us, "us max:", ra_stats.max_stall_us, "us"
+    );
+  }
+
+#endif // HAS_SD_READ_AHEAD
+
 inline void echo_write_to_file(const char * const fname) {
   SERIAL_ECHOLNPGM(STR_SD_WRITE_TO_FILE, fname);
 }
@@ -830,7 +1093,7 @@ void CardReader::removeFile(const char * const name) {
 
 void CardReader::report_status() {
   if (isPrinting() || isPaused()) {
-    SERIAL_ECHOPGM(STR_SD_PRINTING_BYTE, sdpos);
+    SERIAL_ECHOPGM(STR_SD_PRINTING_BYTE, mediaIndex());
     SERIAL_CHAR('/');
     SERIAL_ECHOLN(filesize);
   }
@@ -978,6 +1241,7 @@ void CardReader::closefile(const bool store_location/*=false*/) {
   file.sync();
   file.close();
   flag.saving = flag.logging = false;
+  TERN_(HEATSHRINK_GCODE, flag.compressed = false);
   sdpos = 0;
   TERN_(EMERGENCY_PARSER, emergency_parser.enable());
 
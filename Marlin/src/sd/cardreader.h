@@ -47,6 +47,10 @@ extern const char M23_STR[], M24_STR[];
   #include "usb_flashdrive/Sd2Card_FlashDrive.h"
 #endif
 
+#if ENABLED(HEATSHRINK_GCODE)
+  #include "../libs/heatshrink/heatshrink_decoder.h"
+#endif
+
 #if NEED_SD2CARD_SDIO
   #include "Sd2Card_sdio.h"
 #elif NEED_SD2CARD_SPI
@@ -80,6 +84,9 @@ typedef struct {
        #if ENABLED(BINARY_FILE_TRANSFER)
          , binary_mode:1
        #endif
+       #if ENABLED(HEATSHRINK_GCODE)
+         , compressed:1
+       #endif
     ;
 } card_flags_t;
 
@@ -173,13 +180,13 @@ public:
   #if HAS_PRINT_PROGRESS_PERMYRIAD
     static uint16_t permyriadDone() {
       if (flag.sdprintdone) return 10000;
-      if (isFileOpen() && filesize) return sdpos / ((filesize + 9999) / 10000);
+      if (isFileOpen() && filesize) return mediaIndex() / ((filesize + 9999) / 10000);
       return 0;
     }
   #endif
   static uint8_t percentDone() {
     if (flag.sdprintdone) return 100;
-    if (isFileOpen() && filesize) return sdpos / ((filesize + 99) / 100);
+    if (isFileOpen() && filesize) return mediaIndex() / ((filesize + 99) / 100);
     return 0;
   }
 
@@ -229,13 +236,54 @@ public:
   static uint32_t getFileSize()  { return filesize; }
   static uint32_t getIndex()     { return sdpos; }
   static bool isFileOpen()       { return isMounted() && file.isOpen(); }
-  static bool eof()              { return getIndex() >= getFileSize(); }
+
+  #if ENABLED(HEATSHRINK_GCODE)
+    // For compressed files the index counts decompressed bytes, and progress uses the position on the media
+    static bool isCompressed()     { return flag.compressed; }
+    #if ENABLED(MARLIN_TEST_BUILD)
+      static void test_heatshrink();
+    #endif
+    static uint32_t mediaIndex()   { return flag.compressed ? TERN(HAS_SD_READ_AHEAD, ra_pos, file.curPosition()) : sdpos; }
+    static bool eof()              { return flag.compressed ? hs_done : getIndex() >= getFileSize(); }
+  #else
+    static uint32_t mediaIndex()   { return sdpos; }
+    static bool eof()              { return getIndex() >= getFileSize(); }
+  #endif
 
   // File data operations
-  static int16_t get()                            { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
-  static int16_t read(void *buf, uint16_t nbyte)  { return file.isOpen() ? file.read(buf, nbyte) : -1; }
+  static int16_t get() {
+    #if ENABLED(HEATSHRINK_GCODE)
+      if (flag.compressed) return hs_get();
+    #endif
+    #if HAS_SD_READ_AHEAD
+      int16_t out = ra_get(); sdpos = ra_pos; return out;
+    #else
+      int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out;
+    #endif
+  }
+  static int16_t read(void *buf, uint16_t nbyte)  { return file.isOpen() ? TERN(HAS_SD_READ_AHEAD, ra_read, file.read)(buf, nbyte) : -1; }
   static int16_t write(void *buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
-  static void setIndex(const uint32_t index)      { file.seekSet((sdpos = index)); }
+  static void setIndex(const uint32_t index) {
+    #if ENABLED(HEATSHRINK_GCODE)
+      if (flag.compressed) return hs_seek(index);
+    #endif
+    TERN(HAS_SD_READ_AHEAD, ra_seek, file.seekSet)((sdpos = index));
+  }
+
+  #if HAS_SD_READ_AHEAD
+    // Read-ahead statistics, reset when a file is opened
+    typedef struct {
+      uint32_t hits,          // Blocks that were already loaded when needed
+               misses,        // Blocks that had to be read while waiting
+               reads,         // Media read commands
+               blocks,        // Blocks read
+               stall_us,      // Total time spent waiting for misses
+               max_stall_us;  // Longest wait for a miss
+    } read_ahead_stats_t;
+    static read_ahead_stats_t ra_stats;
+    static void readAhead();
+    static void report_read_ahead();
+  #endif
 
   // TODO: rename to diskIODriver()
   static DiskIODriver* diskIODriver() { return driver; }
@@ -328,6 +376,39 @@ private:
   static uint32_t filesize, // Total size of the current file, in bytes
                   sdpos;    // Index most recently read (one behind file.getPos)
 
+  //
+  // Read-ahead ring for the printing file. When it holds blocks the file position is just past the last one.
+  //
+  #if HAS_SD_READ_AHEAD
+    static uint8_t ra_buffer[SD_READ_AHEAD_BLOCKS][512];
+    static uint32_t ra_block,   // File block in the head slot, or the next block to load if the ring is empty
+                    ra_pos;     // File position of the next byte to get
+    static uint8_t ra_head,     // Ring slot holding ra_block
+                   ra_count;    // Number of blocks loaded
+    static void ra_reset();
+    static void ra_drop(const uint32_t block);
+    static void ra_fill();
+    static int16_t ra_get();
+    static int16_t ra_read(void *buf, const uint16_t nbyte);
+    static void ra_seek(const uint32_t pos);
+  #endif
+
+  //
+  // Heatshrink-compressed G-code (*.HS)
+  // The decoder window is fixed at 2^HEATSHRINK_STATIC_WINDOW_BITS bytes.
+  //
+  #if ENABLED(HEATSHRINK_GCODE)
+    static heatshrink_decoder hsd;
+    static uint8_t hs_buffer[HEATSHRINK_STATIC_INPUT_BUFFER_SIZE], // Decoded bytes not yet read
+                   hs_index, hs_count;
+    static bool hs_done,                                            // Compressed data exhausted
+                hs_error;                                           // Stopped by a read or decoder error
+    static void hs_reset();
+    static int16_t hs_read(uint8_t *buf, const uint16_t nbyte);
+    static int16_t hs_get();
+    static void hs_seek(const uint32_t index);
+  #endif
+
   //
   // Procedure calls to other files
   //
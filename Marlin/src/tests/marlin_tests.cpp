@@ -24,6 +24,10 @@
 
 #if ENABLED(MARLIN_TEST_BUILD)
 
+#include "marlin_tests.h"
+#include "../MarlinCore.h"
+#include "../gcode/parser.h"
+#include "../gcode/queue.h"
 #include "../module/endstops.h"
 #include "../module/motion.h"
 #include "../module/planner.h"
@@ -31,12 +35,78 @@
 #include "../module/stepper.h"
 #include "../module/temperature.h"
 
+#if EITHER(AUTO_BED_LEVELING_BILINEAR, MESH_BICUBIC)
+  #include "../feature/bedlevel/bedlevel.h"
+#endif
+
+#if ENABLED(G29_ADAPTIVE_PROBING)
+  #include "../feature/bedlevel/abl/adaptive_probe.h"
+#endif
+
+#if ENABLED(FT_MOTION)
+  #include "../module/ft_motion.h"
+#endif
+
+#if ENABLED(STEP_TRACE)
+  #include "../feature/step_trace.h"
+#endif
+
+#ifdef __PLAT_LINUX__
+  #include <chrono>
+#endif
+
+#if ENABLED(HEATSHRINK_GCODE)
+  #include "../sd/cardreader.h"
+#endif
+
 // Individual tests are localized in each module.
 // Each test produces its own report.
 
+static uint32_t test_failures; // = 0
+
+void countTestFailures(const uint32_t failures) { test_failures += failures; }
+
+uint32_t testMicros() {
+  #ifdef __PLAT_LINUX__
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  #else
+    return micros();
+  #endif
+}
+
 // Startup tests are run at the end of setup()
 void runStartupTests() {
   // Call post-setup tests here to validate behaviors.
+  planner.test_trapezoid_kernel();
+  #if COMMAND_BUFFER_SIZE
+    queue.test_command_buffer();
+  #endif
+  TERN_(BINARY_GCODE, parser.test_binary_gcode());
+  TERN_(HEATSHRINK_GCODE, card.test_heatshrink());
+  #if HAS_USER_THERMISTOR_TABLE
+    thermalManager.test_user_thermistor_tables();
+  #endif
+  #if ENABLED(MESH_BICUBIC)
+    BicubicMesh::test();
+  #elif ENABLED(AUTO_BED_LEVELING_BILINEAR)
+    bedlevel.test_z_corrections();
+  #endif
+  TERN_(G29_ADAPTIVE_PROBING, AdaptiveProbe::test());
+  #if ENABLED(FT_MOTION) && HAS_X_AXIS
+    fxdTiCtrl.test_shaping();
+  #endif
+  TERN_(FTM_SCURVE, fxdTiCtrl.test_scurve());
+  TERN_(STEP_TRACE, StepTrace::test());
+
+  if (test_failures) {
+    SERIAL_ERROR_MSG("Startup tests failed: ", test_failures, " mismatches");
+    #if defined(__PLAT_LINUX__) || defined(__PLAT_NATIVE_SIM__)
+      SERIAL_FLUSHTX();
+      exit(1);  // Fail the host run
+    #else
+      kill(F("Startup tests failed"));
+    #endif
+  }
 }
 
 // Periodic tests are run from within loop()
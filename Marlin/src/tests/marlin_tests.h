@@ -23,3 +23,10 @@
 
 void runStartupTests();
 void runPeriodicTests();
+
+// Each test adds its failures, so the run fails at the end if any test failed
+void countTestFailures(const uint32_t failures);
+
+// Microseconds for the test timings. On the Linux HAL these are host time, which
+// also runs while --benchmark holds the firmware clock still.
+uint32_t testMicros();
@@ -57,6 +57,7 @@ class Protocol(object):
     packet_buffer = None
     simulate_errors = 0
     sync = 0
+    window = 1
     connected = False
     syncronised = False
     worker_thread = None
@@ -77,6 +78,7 @@ class Protocol(object):
         self.response_timeout = timeout
 
         self.register(['ok', 'rs', 'ss', 'fe'], self.process_input)
+        self.register(['sw'], self.response_stream_window)
 
         self.worker_thread = threading.Thread(target=Protocol.receive_worker, args=(self,))
         self.worker_thread.start()
@@ -148,6 +150,69 @@ class Protocol(object):
                 #print("Packetloss detected..")
         self.packet_transit = None
 
+    def send_window(self, protocol, packet_type, blocks, progress = None):
+        """
+        Send a list of payloads with up to 'window' packets in flight.
+        The client acknowledges each packet and holds those that arrive after
+        a lost or corrupt one, so only the missing packets are resent.
+        progress(acked_count) is called as packets are acknowledged, and can
+        return False to stop the transfer.
+        """
+        base = 0          # oldest unacknowledged block
+        next_block = 0    # next block to transmit
+        acked = set()
+        sent_time = {}
+
+        def transmit(block):
+            sync = (self.sync + block - base) % 256
+            self.transmit_packet(self.build_packet(protocol, packet_type, blocks[block], sync))
+            sent_time[block] = millis()
+
+        timeout = TimeOut(self.response_timeout * 20)
+        while base < len(blocks):
+            while next_block < len(blocks) and next_block - base < self.window:
+                transmit(next_block)
+                next_block += 1
+
+            if not len(self.responses):
+                time.sleep(0.00001)
+
+            while len(self.responses):
+                token, data = self.responses.popleft()
+                if token == 'fe':
+                    raise FatalError()
+                if token not in ('ok', 'rs'):
+                    continue
+                try:
+                    offset = (int(data) - self.sync) % 256
+                except ValueError:
+                    continue
+                if offset >= next_block - base:
+                    continue  # duplicate response for a packet that is no longer in flight
+                block = base + offset
+                if token == 'ok':
+                    acked.add(block)
+                else:
+                    self.errors += 1
+                    if block not in acked:
+                        transmit(block)
+
+            if base in acked:
+                while base in acked:
+                    acked.remove(base)
+                    base += 1
+                    self.sync = (self.sync + 1) % 256
+                timeout.reset()
+                if progress and progress(base) == False:
+                    return False
+            elif base < next_block and millis() - sent_time[base] > self.response_timeout:
+                self.errors += 1  # packet loss, resend the oldest packet
+                transmit(base)
+
+            if timeout.timedout():
+                raise ConnectionLost()
+        return True
+
     def await_response(self):
         timeout = TimeOut(self.response_timeout)
         while not len(self.responses):
@@ -212,7 +277,7 @@ class Protocol(object):
         self.port.write(packet)
         self.transmit_attempt += 1
 
-    def build_packet(self, protocol, packet_type, data = bytearray()):
+    def build_packet(self, protocol, packet_type, data = bytearray(), sync = None):
         PACKET_TOKEN = 0xB5AD
 
         if len(data) > self.max_block_size:
@@ -220,7 +285,7 @@ class Protocol(object):
 
         packet_buffer = bytearray()
 
-        packet_buffer += self.pack_int8(self.sync)                           # 8bit sync id
+        packet_buffer += self.pack_int8(self.sync if sync is None else sync) # 8bit sync id
         packet_buffer += self.pack_int4_2(protocol, packet_type)             # 4 bit protocol id, 4 bit packet type
         packet_buffer += self.pack_int16(len(data))                          # 16bit packet length
         packet_buffer += self.pack_int16(self.build_checksum(packet_buffer)) # 16bit header checksum
@@ -293,6 +358,13 @@ class Protocol(object):
         self.syncronised = True
         print("Connection synced [{0}], binary protocol version {1}, {2} byte payload buffer".format(self.sync, self.protocol_version, self.max_block_size))
 
+    def response_stream_window(self, data):
+        token, window = data
+        try:
+            self.window = max(int(window), 1)
+        except ValueError:
+            self.window = 1
+
     def response_fatal_error(self, data):
         raise FatalError()
 
@@ -413,11 +485,11 @@ class FileTransferProtocol(object):
         kibs = 0
         dump_pctg = 0
         start_time = millis()
-        for i in range(blocks):
-            start = block_size * i
-            end = start + block_size
-            self.write(data[start:end])
-            kibs = (( (i+1) * block_size) / 1024) / (millis() + 1 - start_time) * 1000
+
+        def progress(count):
+            nonlocal kibs, dump_pctg
+            i = count - 1
+            kibs = ((count * block_size) / 1024) / (millis() + 1 - start_time) * 1000
             if (i / blocks) >= dump_pctg:
                 print("\r{0:2.0f}% {1:4.2f}KiB/s {2} Errors: {3}".format((i / blocks) * 100, kibs, "[{0:4.2f}KiB/s]".format(kibs * cratio) if compression_support else "", self.protocol.errors), end='')
                 dump_pctg += 0.1
@@ -425,12 +497,34 @@ class FileTransferProtocol(object):
                 # Dump last status (errors may not be visible)
                 print("\r{0:2.0f}% {1:4.2f}KiB/s {2} Errors: {3} - Aborting...".format((i / blocks) * 100, kibs, "[{0:4.2f}KiB/s]".format(kibs * cratio) if compression_support else "", self.protocol.errors), end='')
                 print("")   # New line to break the transfer speed line
-                self.close()
-                print("Transfer aborted due to protocol errors")
-                #raise Exception("Transfer aborted due to protocol errors")
-                return False;
+                return False
+            return True
+
+        if self.protocol.window > 1:
+            print("Sending with up to {0} packets in flight".format(self.protocol.window))
+            completed = self.protocol.send_window(FileTransferProtocol.protocol_id, FileTransferProtocol.Packet.WRITE,
+                                                  [data[block_size * i:block_size * (i + 1)] for i in range(blocks)], progress)
+        else:
+            completed = True
+            for i in range(blocks):
+                start = block_size * i
+                end = start + block_size
+                self.write(data[start:end])
+                if not progress(i + 1):
+                    completed = False
+                    break
+
+        if not completed:
+            self.close()
+            print("Transfer aborted due to protocol errors")
+            #raise Exception("Transfer aborted due to protocol errors")
+            return False
         print("\r{0:2.0f}% {1:4.2f}KiB/s {2} Errors: {3}".format(100, kibs, "[{0:4.2f}KiB/s]".format(kibs * cratio) if compression_support else "", self.protocol.errors)) # no one likes transfers finishing at 99.8%
 
+        elapsed = (millis() - start_time) / 1000
+        print("Throughput: {0} bytes in {1} packets, {2:.2f}s, {3:.2f}KiB/s ({4:.2f}KiB/s of file data), window {5}".format(
+            len(data), blocks, elapsed, len(data) / 1024 / max(elapsed, 0.001), filesize / 1024 / max(elapsed, 0.001), self.protocol.window))
+
         if not self.close():
             print("Transfer failed")
             return False
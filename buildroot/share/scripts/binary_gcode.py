@@ -0,0 +1,208 @@
+#!/usr/bin/env python3
+#
+# binary_gcode.py
+# Encode G-code as BINARY_GCODE packets and compare the size with text and MeatPack.
+# Optionally stream a file to a printer, mixing binary and text commands.
+#
+#   binary_gcode.py file.gcode                   # Report bytes per command
+#   binary_gcode.py file.gcode -o file.bin       # Write the encoded stream
+#   binary_gcode.py file.gcode --port /dev/ttyUSB0 --baud 250000 [--text]
+#
+# Packet format (see BINARY_GCODE in Marlin/src/gcode/parser.h):
+#
+#   SYNC LEN PAYLOAD[LEN] CHECKSUM     CHECKSUM is the XOR of all the preceding bytes
+#
+#   PAYLOAD: HEAD [N:int32] CODE:uint8|uint16 [SUBCODE:uint8] { TAG VALUE }...
+#   HEAD bits 0-1: G, M, T, D  bit 2: 16-bit code  bit 3: subcode  bit 4: line number
+#   TAG: type << 5 | letter - 'A'
+#
+import argparse
+import re
+import struct
+import sys
+import time
+from decimal import Decimal, InvalidOperation
+
+SYNC = 0xB5
+MAX_CMD_SIZE = 96
+
+HEAD_CODE16, HEAD_SUBCODE, HEAD_LINE_NUMBER = 0x04, 0x08, 0x10
+FLAG, INT8, INT16, INT32, FLOAT, MILLI16, MILLI24 = range(7)
+
+# Commands with string arguments, or that must be seen early as text
+TEXT_ONLY = {
+    'M': {16, 23, 28, 29, 30, 32, 33, 108, 112, 117, 118, 410, 552, 553, 554, 876, 928} | set(range(810, 820)),
+}
+
+COMMAND_RE = re.compile(r'^([GMTD])(-?\d+)(?:\.(\d+))?((?:\s*[A-Z][-+]?[0-9.]*)*)\s*$')
+PARAM_RE = re.compile(r'([A-Z])([-+]?[0-9.]*)')
+
+def strip_comments(line):
+    line = re.sub(r'\([^)]*\)', '', line)
+    return line.split(';', 1)[0].strip()
+
+def encode_value(letter, text):
+    """Encode one parameter with the smallest type that gives the same value as strtof/strtol."""
+    ind = ord(letter) - ord('A')
+    if text == '':
+        return bytes([FLAG << 5 | ind])
+    try:
+        value = Decimal(text)
+    except InvalidOperation:
+        return None
+    if value == value.to_integral_value():
+        v = int(value)
+        if -128 <= v <= 127:
+            return bytes([INT8 << 5 | ind]) + struct.pack('<b', v)
+        if -32768 <= v <= 32767:
+            return bytes([INT16 << 5 | ind]) + struct.pack('<h', v)
+        if -2**31 <= v < 2**31:
+            return bytes([INT32 << 5 | ind]) + struct.pack('<i', v)
+    milli = value * 1000
+    if milli == milli.to_integral_value():
+        m = int(milli)
+        if -32768 <= m <= 32767:
+            return bytes([MILLI16 << 5 | ind]) + struct.pack('<h', m)
+        if -2**23 <= m < 2**23:
+            return bytes([MILLI24 << 5 | ind]) + struct.pack('<i', m)[:3]
+    return bytes([FLOAT << 5 | ind]) + struct.pack('<f', float(value))
+
+def encode(line, line_number=None):
+    """Return a binary packet for a line of G-code, or None if it must be sent as text."""
+    m = COMMAND_RE.match(line)
+    if not m:
+        return None
+    letter, code, subcode, params = m.group(1), int(m.group(2)), m.group(3), m.group(4)
+    if not 0 <= code <= 65535 or code in TEXT_ONLY.get(letter, ()):
+        return None
+
+    head = 'GMTD'.index(letter)
+    payload = b''
+    if line_number is not None:
+        head |= HEAD_LINE_NUMBER
+        payload += struct.pack('<i', line_number)
+    if code > 255:
+        head |= HEAD_CODE16
+        payload += struct.pack('<H', code)
+    else:
+        payload += bytes([code])
+    if subcode is not None:
+        head |= HEAD_SUBCODE
+        payload += bytes([int(subcode)])
+
+    seen = set()
+    for p in PARAM_RE.finditer(params.replace(' ', '')):
+        if p.group(1) in seen:
+            return None
+        seen.add(p.group(1))
+        value = encode_value(p.group(1), p.group(2))
+        if value is None:
+            return None
+        payload += value
+
+    payload = bytes([head]) + payload
+    if len(payload) > MAX_CMD_SIZE - 3:
+        return None
+    packet = bytes([SYNC, len(payload)]) + payload
+    checksum = 0
+    for b in packet:
+        checksum ^= b
+    return packet + bytes([checksum])
+
+def text_line(line, line_number=None):
+    """The line as a host sends it, with an optional line number and checksum."""
+    if line_number is not None:
+        line = 'N%d %s' % (line_number, line)
+        checksum = 0
+        for c in line.encode():
+            checksum ^= c
+        line += '*%d' % checksum
+    return (line + '\n').encode()
+
+# MeatPack packs these characters into 4 bits. Others take 4 + 8 bits.
+MEATPACK_CHARS = set('0123456789. \nGX')
+
+def meatpack_bits(data):
+    return sum(4 if chr(c) in MEATPACK_CHARS else 12 for c in data)
+
+def commands(path):
+    with open(path, 'r', errors='replace') as f:
+        for raw in f:
+            line = strip_comments(raw)
+            if line:
+                yield line
+
+def report(path, output, line_numbers):
+    count = binary_count = text_bytes = meatpack_bytes = binary_bytes = 0
+    out = open(output, 'wb') if output else None
+    n = 1 if line_numbers else None
+    for line in commands(path):
+        text = text_line(line, n)
+        packet = encode(line, n)
+        count += 1
+        text_bytes += len(text)
+        meatpack_bytes += (meatpack_bits(text) + 7) // 8
+        if packet:
+            binary_count += 1
+        data = packet or text
+        binary_bytes += len(data)
+        if out:
+            out.write(data)
+        if n is not None:
+            n += 1
+    if out:
+        out.close()
+    if not count:
+        print('No commands in', path)
+        return
+    print('Commands         : %d (%d binary)' % (count, binary_count))
+    for name, total in (('Text', text_bytes), ('MeatPack (est.)', meatpack_bytes), ('Binary', binary_bytes)):
+        print('%-17s: %9d bytes  %6.2f bytes/command  %5.1f%%' % (name, total, total / count, 100.0 * total / text_bytes))
+
+def stream(path, port, baud, as_text):
+    """Send each command and wait for 'ok'. Report the time per command."""
+    import serial
+    ser = serial.Serial(port, baud, timeout=10)
+    time.sleep(2)
+    ser.reset_input_buffer()
+    ser.write(b'M110 N0\n')
+    n, count, sent = 1, 0, 0
+    start = time.perf_counter()
+    for line in commands(path):
+        data = text_line(line, n) if as_text else (encode(line, n) or text_line(line, n))
+        while True:
+            ser.write(data)
+            sent += len(data)
+            resend = False
+            while True:
+                reply = ser.readline().decode(errors='replace').strip()
+                if not reply:
+                    raise TimeoutError('No reply to: ' + line)
+                if reply.startswith('Resend:'):
+                    resend = True
+                elif reply.startswith('ok'):
+                    break
+            if not resend:
+                break
+        n += 1
+        count += 1
+    elapsed = time.perf_counter() - start
+    ser.close()
+    print('%d commands, %d bytes in %.2fs: %.3f ms/command, %.0f bytes/s' % (count, sent, elapsed, 1000 * elapsed / count, sent / elapsed))
+
+def main():
+    parser = argparse.ArgumentParser(description='Encode G-code as BINARY_GCODE packets.')
+    parser.add_argument('file', help='G-code file')
+    parser.add_argument('-o', '--output', help='write the encoded stream to this file')
+    parser.add_argument('-n', '--line-numbers', action='store_true', help='include line numbers and checksums, as when streaming')
+    parser.add_argument('--port', help='stream the file to the printer on this serial port')
+    parser.add_argument('--baud', type=int, default=250000)
+    parser.add_argument('--text', action='store_true', help='stream as text, for comparison')
+    args = parser.parse_args()
+    if args.port:
+        stream(args.file, args.port, args.baud, args.text)
+    else:
+        report(args.file, args.output, args.line_numbers)
+
+if __name__ == '__main__':
+    sys.exit(main())
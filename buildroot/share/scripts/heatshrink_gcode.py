@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+#
+# heatshrink_gcode.py
+# Compress G-code for printing with HEATSHRINK_GCODE, and check the result.
+#
+#   heatshrink_gcode.py part.gcode                 # Write part.gcode.hs
+#   heatshrink_gcode.py part.gcode -o PART.HS      # Write to a given file
+#   heatshrink_gcode.py -d PART.HS -o part.gcode   # Decompress
+#   heatshrink_gcode.py --test *.gcode             # Check that files decompress byte for byte
+#
+# The firmware decoder has a fixed window, so files must be compressed with the
+# same settings as HEATSHRINK_STATIC_WINDOW_BITS and HEATSHRINK_STATIC_LOOKAHEAD_BITS
+# in Marlin/src/libs/heatshrink/heatshrink_config.h.
+#
+# The stream format is heatshrink's: a 1 tag bit is followed by an 8 bit literal,
+# and a 0 tag bit by a back-reference of (offset - 1) in WINDOW bits and
+# (length - 1) in LOOKAHEAD bits. Bits are packed MSB first.
+#
+import argparse
+import sys
+
+WINDOW_BITS = 8
+LOOKAHEAD_BITS = 4
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.byte = 0
+        self.count = 0
+
+    def write(self, value, bits):
+        for i in range(bits - 1, -1, -1):
+            self.byte = (self.byte << 1) | ((value >> i) & 1)
+            self.count += 1
+            if self.count == 8:
+                self.out.append(self.byte)
+                self.byte = self.count = 0
+
+    def finish(self):
+        if self.count:
+            self.out.append(self.byte << (8 - self.count))
+        return bytes(self.out)
+
+def compress(data, window_bits=WINDOW_BITS, lookahead_bits=LOOKAHEAD_BITS):
+    """Greedy LZSS encoder producing a heatshrink stream."""
+    window, max_len = 1 << window_bits, 1 << lookahead_bits
+    # A back-reference costs 1 + window_bits + lookahead_bits bits, a literal 9 bits
+    min_len = (1 + window_bits + lookahead_bits) // 9 + 1
+    bits = BitWriter()
+    recent = {}  # two-byte prefix -> positions, newest last
+    pos, size = 0, len(data)
+
+    def remember(p):
+        if p + 1 < size:
+            recent.setdefault(data[p:p + 2], []).append(p)
+
+    while pos < size:
+        best_len, best_off = 0, 0
+        if pos + 1 < size:
+            limit = min(max_len, size - pos)
+            candidates = recent.get(data[pos:pos + 2], [])
+            while candidates and candidates[0] < pos - window:
+                candidates.pop(0)
+            for start in reversed(candidates):
+                length = 2
+                while length < limit and data[start + length] == data[pos + length]:
+                    length += 1
+                if length > best_len:
+                    best_len, best_off = length, pos - start
+                    if length == limit:
+                        break
+        if best_len >= min_len:
+            bits.write(0, 1)
+            bits.write(best_off - 1, window_bits)
+            bits.write(best_len - 1, lookahead_bits)
+            for p in range(pos, pos + best_len):
+                remember(p)
+            pos += best_len
+        else:
+            bits.write(1, 1)
+            bits.write(data[pos], 8)
+            remember(pos)
+            pos += 1
+    return bits.finish()
+
+def decompress(data, window_bits=WINDOW_BITS, lookahead_bits=LOOKAHEAD_BITS):
+    """Decode a heatshrink stream with a window of the same size as the firmware decoder."""
+    window = bytearray(1 << window_bits)
+    mask = len(window) - 1
+    head = 0
+    out = bytearray()
+
+    def bits_in():
+        for b in data:
+            for i in range(7, -1, -1):
+                yield (b >> i) & 1
+
+    stream = bits_in()
+
+    def get(n):
+        value = 0
+        for _ in range(n):
+            bit = next(stream, None)
+            if bit is None:
+                return None
+            value = (value << 1) | bit
+        return value
+
+    while True:
+        tag = get(1)
+        if tag is None:
+            break
+        if tag:
+            c = get(8)
+            if c is None:
+                break
+            window[head & mask] = c
+            head += 1
+            out.append(c)
+        else:
+            index = get(window_bits)
+            if index is None:
+                break  # zero padding at the end of the stream
+            count = get(lookahead_bits)
+            if count is None:
+                break
+            for _ in range(count + 1):
+                c = window[(head - index - 1) & mask]
+                window[head & mask] = c
+                head += 1
+                out.append(c)
+    return bytes(out)
+
+def report(name, original, compressed):
+    ratio = len(original) / len(compressed) if compressed else 0
+    print('%s: %d -> %d bytes (%.2f:1, %.1f%%)' % (name, len(original), len(compressed), ratio, 100.0 * len(compressed) / max(len(original), 1)))
+
+def main():
+    parser = argparse.ArgumentParser(description='Compress G-code for HEATSHRINK_GCODE.')
+    parser.add_argument('files', nargs='+', help='input files')
+    parser.add_argument('-o', '--output', help='output file (one input only)')
+    parser.add_argument('-d', '--decompress', action='store_true', help='decompress instead')
+    parser.add_argument('--test', action='store_true', help='compress, decompress, and compare with the original')
+    args = parser.parse_args()
+
+    if args.output and len(args.files) > 1:
+        parser.error('--output needs a single input file')
+
+    failed = 0
+    for name in args.files:
+        with open(name, 'rb') as f:
+            data = f.read()
+
+        if args.test:
+            packed = compress(data)
+            unpacked = decompress(packed)
+            report(name, data, packed)
+            if unpacked != data:
+                failed += 1
+                first = next((i for i in range(min(len(data), len(unpacked))) if data[i] != unpacked[i]), min(len(data), len(unpacked)))
+                print('  MISMATCH at byte %d (%d bytes out, %d expected)' % (first, len(unpacked), len(data)))
+            else:
+                print('  OK: byte-exact')
+        elif args.decompress:
+            out = args.output or (name[:-3] if name.lower().endswith('.hs') else name + '.out')
+            with open(out, 'wb') as f:
+                f.write(decompress(data))
+        else:
+            packed = compress(data)
+            out = args.output or name + '.hs'
+            with open(out, 'wb') as f:
+                f.write(packed)
+            report(out, data, packed)
+
+    return 1 if failed else 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,294 @@
+#!/usr/bin/env python3
+#
+# step_trace.py
+# Reconstruct the motion of each axis from a STEP_TRACE step trace.
+#
+#   step_trace.py trace.csv                      # Report the peaks of each axis
+#   step_trace.py serial.log --csv motion.csv    # Also write the resampled motion
+#   step_trace.py trace.csv --plot               # Plot velocity, acceleration and jerk
+#   step_trace.py --test                         # Check the reconstruction on a known move
+#
+# The trace is what D580 sends or what 'marlin --benchmark --trace file.csv' writes:
+#
+#   # step trace rate=<ticks/s> axes=X,Y,Z,E steps_per_mm=80.0000,80.0000,400.0000,93.0000
+#   <tick>,<block>,<steps>,<dirs>
+#   # dropped <count>
+#
+# 'steps' and 'dirs' are axis masks in the order of 'axes'. Other lines, such as the
+# rest of a serial log, are ignored. The last trace in the input is used. Ticks wrap
+# at 2^32. Dropped events break the trace into segments that are analyzed apart.
+#
+# The position of each axis is taken as linear between the ticks it steps at, so steps sent
+# together by multi-stepping are spread over the time since the last ones, and resampled
+# at a fixed rate. A centered moving average is applied before each derivative, so the jerk is
+# smoothed three times. Widen --smooth if the jerk is mostly step noise.
+#
+import argparse
+import re
+import sys
+
+HEADER = re.compile(r'# step trace rate=(\d+) axes=(\S+) steps_per_mm=(\S+)')
+EVENT = re.compile(r'^(\d+),(\d+),(\d+),(\d+)$')
+DROPPED = re.compile(r'^# dropped (\d+)')
+
+class Trace:
+    def __init__(self, rate, axes, steps_per_mm):
+        self.rate = rate
+        self.axes = axes
+        self.steps_per_mm = steps_per_mm
+        self.segments = [[]]    # (tick, block, steps, dirs), ticks unwrapped
+        self.dropped = 0
+        self.last_tick = None
+        self.wraps = 0
+
+    def add(self, tick, block, steps, dirs):
+        if self.last_tick is not None and tick < self.last_tick:
+            self.wraps += 1
+        self.last_tick = tick
+        self.segments[-1].append((tick + (self.wraps << 32), block, steps, dirs))
+
+    def gap(self, count):
+        self.dropped += count
+        if self.segments[-1]:
+            self.segments.append([])
+
+def read_trace(lines):
+    trace = None
+    for line in lines:
+        line = line.strip()
+        m = HEADER.search(line)
+        if m:
+            trace = Trace(int(m.group(1)), m.group(2).split(','), [float(s) for s in m.group(3).split(',')])
+            continue
+        if not trace:
+            continue
+        m = EVENT.match(line)
+        if m:
+            trace.add(*(int(g) for g in m.groups()))
+            continue
+        m = DROPPED.match(line)
+        if m:
+            trace.gap(int(m.group(1)))
+    return trace
+
+def smooth(values, width):
+    """Centered moving average, narrowing at the ends."""
+    if width < 2:
+        return list(values)
+    half = width // 2
+    sums = [0.0]
+    for v in values:
+        sums.append(sums[-1] + v)
+    n = len(values)
+    out = []
+    for i in range(n):
+        a, b = max(0, i - half), min(n, i + half + 1)
+        out.append((sums[b] - sums[a]) / (b - a))
+    return out
+
+def derivative(values, rate):
+    """Centered difference, one-sided at the ends."""
+    n = len(values)
+    if n < 2:
+        return [0.0] * n
+    out = [(values[1] - values[0]) * rate]
+    for i in range(1, n - 1):
+        out.append((values[i + 1] - values[i - 1]) * rate / 2)
+    out.append((values[-1] - values[-2]) * rate)
+    return out
+
+class AxisMotion:
+    def __init__(self, name):
+        self.name = name
+        self.steps = 0
+        self.distance = 0.0
+        self.reversals = 0
+        self.max_step_rate = 0.0
+        self.max_burst = 0
+        self.peak = [0.0, 0.0, 0.0]   # velocity, acceleration, jerk
+        self.series = []              # per segment: (times, position, velocity, acceleration, jerk)
+
+def analyze(trace, sample_rate, smooth_s):
+    width = max(1, int(round(smooth_s * sample_rate)))
+    axes = [AxisMotion(name) for name in trace.axes]
+    blocks = 0
+    for segment in trace.segments:
+        if not segment:
+            continue
+        last_block = None
+        for _, block, _, _ in segment:
+            if block != last_block:
+                blocks += 1
+                last_block = block
+        t0, t1 = segment[0][0], segment[-1][0]
+        for a, axis in enumerate(axes):
+            bit = 1 << a
+            spm = trace.steps_per_mm[a] if a < len(trace.steps_per_mm) else 1.0
+            # Position after the steps at each tick, and the step statistics
+            times, pos = [], []
+            last_dir = None
+            for tick, _, steps, dirs in segment:
+                if not steps & bit:
+                    continue
+                fwd = bool(dirs & bit)
+                if last_dir is not None and fwd != last_dir:
+                    axis.reversals += 1
+                last_dir = fwd
+                if not times or tick != times[-1]:
+                    times.append(tick)
+                    pos.append(pos[-1] if pos else 0)
+                    burst = 0
+                pos[-1] += 1 if fwd else -1
+                burst += 1
+                axis.max_burst = max(axis.max_burst, burst)
+                if len(times) > 1:
+                    axis.max_step_rate = max(axis.max_step_rate, burst * trace.rate / (tick - times[-2]))
+                axis.steps += 1
+            if not times:
+                continue
+            axis.distance += pos[-1] / spm
+            # Hold still before the first step
+            times.insert(0, t0)
+            pos.insert(0, pos[0])
+            # Resample the position, linear between steps
+            n = int((t1 - t0) * sample_rate / trace.rate) + 1
+            ts, ps, k = [], [], 0
+            for i in range(n):
+                t = t0 + i * trace.rate / sample_rate
+                while k + 1 < len(times) and times[k + 1] <= t:
+                    k += 1
+                if k + 1 < len(times) and times[k + 1] > times[k]:
+                    p = pos[k] + (pos[k + 1] - pos[k]) * (t - times[k]) / (times[k + 1] - times[k])
+                else:
+                    p = pos[k]
+                ts.append(t / trace.rate)
+                ps.append(p / spm)
+            v = derivative(smooth(ps, width), sample_rate)
+            acc = derivative(smooth(v, width), sample_rate)
+            j = derivative(smooth(acc, width), sample_rate)
+            # The smoothing narrows at the ends of a segment, so leave them out of the peaks
+            edge = 2 * width
+            for d, values in enumerate((v, acc, j)):
+                if len(values) > 2 * edge:
+                    axis.peak[d] = max(axis.peak[d], max(abs(x) for x in values[edge:-edge]))
+            axis.series.append((ts, ps, v, acc, j))
+    return axes, blocks
+
+def report(trace, axes, blocks, out=sys.stdout):
+    events = sum(len(s) for s in trace.segments)
+    ticks = sum(s[-1][0] - s[0][0] for s in trace.segments if s)
+    out.write('Events %d in %d segment(s), %.3fs, %d blocks, %d dropped\n'
+              % (events, sum(1 for s in trace.segments if s), ticks / trace.rate, blocks, trace.dropped))
+    out.write('Axis      Steps   Net mm  Reversals  Max steps/s  Max burst   Peak mm/s   Peak mm/s^2   Peak mm/s^3\n')
+    for axis in axes:
+        if not axis.steps:
+            continue
+        out.write('%-4s %10d %8.2f %10d %12.0f %10d %11.1f %13.0f %13.0f\n'
+                  % (axis.name, axis.steps, axis.distance, axis.reversals, axis.max_step_rate,
+                     axis.max_burst, axis.peak[0], axis.peak[1], axis.peak[2]))
+
+def write_csv(path, axes):
+    names = [a.name for a in axes if a.series]
+    with open(path, 'w') as f:
+        f.write('segment,time,' + ','.join('%s_mm,%s_v,%s_a,%s_j' % (n, n, n, n) for n in names) + '\n')
+        moving = [a for a in axes if a.series]
+        for s in range(len(moving[0].series) if moving else 0):
+            ts = moving[0].series[s][0]
+            for i, t in enumerate(ts):
+                cols = []
+                for a in moving:
+                    series = a.series[s] if s < len(a.series) else None
+                    if series and i < len(series[0]):
+                        cols += ['%.5f' % series[1][i]] + ['%.3f' % series[d][i] for d in (2, 3, 4)]
+                    else:
+                        cols += [''] * 4
+                f.write('%d,%.6f,%s\n' % (s, t, ','.join(cols)))
+
+def plot(axes):
+    try:
+        import matplotlib.pyplot as plt
+    except ImportError:
+        sys.exit('step_trace.py: --plot requires matplotlib')
+    fig, rows = plt.subplots(3, 1, sharex=True)
+    for axis in axes:
+        for s, (ts, _, v, a, j) in enumerate(axis.series):
+            label = axis.name if s == 0 else None
+            rows[0].plot(ts, v, label=label)
+            rows[1].plot(ts, a, label=label)
+            rows[2].plot(ts, j, label=label)
+    for row, unit in zip(rows, ('mm/s', 'mm/s^2', 'mm/s^3')):
+        row.set_ylabel(unit)
+        row.grid(True)
+    rows[0].legend()
+    rows[2].set_xlabel('s')
+    plt.show()
+
+def synthetic_trace(rate=2000000, spm=80.0, v=100.0, a=2000.0, length=20.0, multistep=4):
+    """A trapezoid move on X as the stepper would send it, with steps sent in bursts at high speed."""
+    lines = ['# step trace rate=%d axes=X,Y steps_per_mm=%.4f,%.4f' % (rate, spm, spm)]
+    t_acc = v / a
+    d_acc = v * t_acc / 2
+    t_total = t_acc * 2 + (length - 2 * d_acc) / v
+    def time_at(d):
+        if d < d_acc:
+            return (2 * d / a) ** 0.5
+        if d < length - d_acc:
+            return t_acc + (d - d_acc) / v
+        return t_total - (2 * (length - d) / a) ** 0.5
+    steps = int(length * spm)
+    tick0 = (1 << 32) - rate // 100   # Wrap the tick 10ms in
+    for n in range(1, steps + 1, multistep):
+        tick = (tick0 + int(time_at(n / spm) * rate)) & 0xFFFFFFFF
+        for _ in range(min(multistep, steps + 1 - n)):
+            lines.append('%d,0,1,1' % tick)
+    return lines, v, a
+
+def self_test():
+    lines, v, a = synthetic_trace()
+    trace = read_trace(['ok'] + lines[:800] + ['# dropped 5'] + lines[800:])
+    axes, _ = analyze(trace, 10000, 0.004)
+    x = axes[0]
+    failures = 0
+    if x.steps != len(lines) - 1 or abs(x.distance - 20.0) > 0.1 or len(trace.segments) != 2:
+        print('Bad step count or segments'); failures += 1
+    if abs(x.peak[0] - v) > 0.03 * v:
+        print('Velocity %.1f, expected %.1f' % (x.peak[0], v)); failures += 1
+    if abs(x.peak[1] - a) > 0.1 * a:
+        print('Acceleration %.0f, expected %.0f' % (x.peak[1], a)); failures += 1
+    if x.max_burst != 4 or x.reversals:
+        print('Burst %d, reversals %d' % (x.max_burst, x.reversals)); failures += 1
+    report(trace, axes, 1)
+    print('step_trace.py: %s' % ('FAILED' if failures else 'OK'))
+    return 1 if failures else 0
+
+def main():
+    parser = argparse.ArgumentParser(description='Reconstruct axis motion from a STEP_TRACE step trace.')
+    parser.add_argument('trace', nargs='?', help='trace file or serial log (default stdin)')
+    parser.add_argument('--rate', type=float, default=10000, help='resampling rate in Hz (default 10000)')
+    parser.add_argument('--smooth', type=float, default=0.004, help='smoothing window in seconds (default 0.004)')
+    parser.add_argument('--csv', help='write the resampled motion to this file')
+    parser.add_argument('--plot', action='store_true', help='plot velocity, acceleration and jerk')
+    parser.add_argument('--test', action='store_true', help='check the reconstruction on a synthetic trace')
+    args = parser.parse_args()
+
+    if args.test:
+        return self_test()
+
+    if args.trace:
+        with open(args.trace, errors='replace') as f:
+            trace = read_trace(f)
+    else:
+        trace = read_trace(sys.stdin)
+    if not trace:
+        sys.exit('step_trace.py: no step trace header found')
+
+    axes, blocks = analyze(trace, args.rate, args.smooth)
+    report(trace, axes, blocks)
+    if args.csv:
+        write_csv(args.csv, axes)
+    if args.plot:
+        plot(axes)
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
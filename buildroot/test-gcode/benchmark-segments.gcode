@@ -0,0 +1,1107 @@
+;
+;  Motion pipeline benchmark: dense short segments
+;  Run with: marlin --benchmark buildroot/test-gcode/benchmark-segments.gcode
+;
+G21 ; millimeters
+G90 ; absolute positioning
+M83 ; relative extrusion
+M302 P1 ; allow cold extrusion on the simulator
+G92 X100 Y100 Z0.2
+G1 F6000
+
+; Circle made of 0.26mm chords
+G0 X130.000 Y100.000 F9000
+G1 F3000
+G1 X129.999 Y100.262 E0.00872
+G1 X129.995 Y100.524 E0.00872
+G1 X129.990 Y100.785 E0.00872
+G1 X129.982 Y101.047 E0.00872
+G1 X129.971 Y101.309 E0.00872
+G1 X129.959 Y101.570 E0.00872
+G1 X129.944 Y101.831 E0.00872
+G1 X129.927 Y102.093 E0.00872
+G1 X129.908 Y102.354 E0.00872
+G1 X129.886 Y102.615 E0.00872
+G1 X129.862 Y102.875 E0.00872
+G1 X129.836 Y103.136 E0.00872
+G1 X129.807 Y103.396 E0.00872
+G1 X129.776 Y103.656 E0.00872
+G1 X129.743 Y103.916 E0.00872
+G1 X129.708 Y104.175 E0.00872
+G1 X129.670 Y104.434 E0.00872
+G1 X129.631 Y104.693 E0.00872
+G1 X129.589 Y104.951 E0.00872
+G1 X129.544 Y105.209 E0.00872
+G1 X129.498 Y105.467 E0.00872
+G1 X129.449 Y105.724 E0.00872
+G1 X129.398 Y105.981 E0.00872
+G1 X129.344 Y106.237 E0.00872
+G1 X129.289 Y106.493 E0.00872
+G1 X129.231 Y106.749 E0.00872
+G1 X129.171 Y107.003 E0.00872
+G1 X129.109 Y107.258 E0.00872
+G1 X129.044 Y107.511 E0.00872
+G1 X128.978 Y107.765 E0.00872
+G1 X128.909 Y108.017 E0.00872
+G1 X128.838 Y108.269 E0.00872
+G1 X128.765 Y108.520 E0.00872
+G1 X128.689 Y108.771 E0.00872
+G1 X128.612 Y109.021 E0.00872
+G1 X128.532 Y109.271 E0.00872
+G1 X128.450 Y109.519 E0.00872
+G1 X128.366 Y109.767 E0.00872
+G1 X128.279 Y110.014 E0.00872
+G1 X128.191 Y110.261 E0.00872
+G1 X128.100 Y110.506 E0.00872
+G1 X128.007 Y110.751 E0.00872
+G1 X127.913 Y110.995 E0.00872
+G1 X127.816 Y111.238 E0.00872
+G1 X127.716 Y111.481 E0.00872
+G1 X127.615 Y111.722 E0.00872
+G1 X127.512 Y111.962 E0.00872
+G1 X127.406 Y112.202 E0.00872
+G1 X127.299 Y112.441 E0.00872
+G1 X127.189 Y112.679 E0.00872
+G1 X127.078 Y112.915 E0.00872
+G1 X126.964 Y113.151 E0.00872
+G1 X126.848 Y113.386 E0.00872
+G1 X126.730 Y113.620 E0.00872
+G1 X126.610 Y113.852 E0.00872
+G1 X126.488 Y114.084 E0.00872
+G1 X126.365 Y114.315 E0.00872
+G1 X126.239 Y114.544 E0.00872
+G1 X126.111 Y114.773 E0.00872
+G1 X125.981 Y115.000 E0.00872
+G1 X125.849 Y115.226 E0.00872
+G1 X125.715 Y115.451 E0.00872
+G1 X125.579 Y115.675 E0.00872
+G1 X125.441 Y115.898 E0.00872
+G1 X125.302 Y116.119 E0.00872
+G1 X125.160 Y116.339 E0.00872
+G1 X125.017 Y116.558 E0.00872
+G1 X124.871 Y116.776 E0.00872
+G1 X124.724 Y116.992 E0.00872
+G1 X124.575 Y117.207 E0.00872
+G1 X124.423 Y117.421 E0.00872
+G1 X124.271 Y117.634 E0.00872
+G1 X124.116 Y117.845 E0.00872
+G1 X123.959 Y118.054 E0.00872
+G1 X123.801 Y118.263 E0.00872
+G1 X123.640 Y118.470 E0.00872
+G1 X123.478 Y118.675 E0.00872
+G1 X123.314 Y118.880 E0.00872
+G1 X123.149 Y119.082 E0.00872
+G1 X122.981 Y119.284 E0.00872
+G1 X122.812 Y119.483 E0.00872
+G1 X122.641 Y119.682 E0.00872
+G1 X122.469 Y119.879 E0.00872
+G1 X122.294 Y120.074 E0.00872
+G1 X122.118 Y120.268 E0.00872
+G1 X121.941 Y120.460 E0.00872
+G1 X121.761 Y120.651 E0.00872
+G1 X121.580 Y120.840 E0.00872
+G1 X121.398 Y121.027 E0.00872
+G1 X121.213 Y121.213 E0.00872
+G1 X121.027 Y121.398 E0.00872
+G1 X120.840 Y121.580 E0.00872
+G1 X120.651 Y121.761 E0.00872
+G1 X120.460 Y121.941 E0.00872
+G1 X120.268 Y122.118 E0.00872
+G1 X120.074 Y122.294 E0.00872
+G1 X119.879 Y122.469 E0.00872
+G1 X119.682 Y122.641 E0.00872
+G1 X119.483 Y122.812 E0.00872
+G1 X119.284 Y122.981 E0.00872
+G1 X119.082 Y123.149 E0.00872
+G1 X118.880 Y123.314 E0.00872
+G1 X118.675 Y123.478 E0.00872
+G1 X118.470 Y123.640 E0.00872
+G1 X118.263 Y123.801 E0.00872
+G1 X118.054 Y123.959 E0.00872
+G1 X117.845 Y124.116 E0.00872
+G1 X117.634 Y124.271 E0.00872
+G1 X117.421 Y124.423 E0.00872
+G1 X117.207 Y124.575 E0.00872
+G1 X116.992 Y124.724 E0.00872
+G1 X116.776 Y124.871 E0.00872
+G1 X116.558 Y125.017 E0.00872
+G1 X116.339 Y125.160 E0.00872
+G1 X116.119 Y125.302 E0.00872
+G1 X115.898 Y125.441 E0.00872
+G1 X115.675 Y125.579 E0.00872
+G1 X115.451 Y125.715 E0.00872
+G1 X115.226 Y125.849 E0.00872
+G1 X115.000 Y125.981 E0.00872
+G1 X114.773 Y126.111 E0.00872
+G1 X114.544 Y126.239 E0.00872
+G1 X114.315 Y126.365 E0.00872
+G1 X114.084 Y126.488 E0.00872
+G1 X113.852 Y126.610 E0.00872
+G1 X113.620 Y126.730 E0.00872
+G1 X113.386 Y126.848 E0.00872
+G1 X113.151 Y126.964 E0.00872
+G1 X112.915 Y127.078 E0.00872
+G1 X112.679 Y127.189 E0.00872
+G1 X112.441 Y127.299 E0.00872
+G1 X112.202 Y127.406 E0.00872
+G1 X111.962 Y127.512 E0.00872
+G1 X111.722 Y127.615 E0.00872
+G1 X111.481 Y127.716 E0.00872
+G1 X111.238 Y127.816 E0.00872
+G1 X110.995 Y127.913 E0.00872
+G1 X110.751 Y128.007 E0.00872
+G1 X110.506 Y128.100 E0.00872
+G1 X110.261 Y128.191 E0.00872
+G1 X110.014 Y128.279 E0.00872
+G1 X109.767 Y128.366 E0.00872
+G1 X109.519 Y128.450 E0.00872
+G1 X109.271 Y128.532 E0.00872
+G1 X109.021 Y128.612 E0.00872
+G1 X108.771 Y128.689 E0.00872
+G1 X108.520 Y128.765 E0.00872
+G1 X108.269 Y128.838 E0.00872
+G1 X108.017 Y128.909 E0.00872
+G1 X107.765 Y128.978 E0.00872
+G1 X107.511 Y129.044 E0.00872
+G1 X107.258 Y129.109 E0.00872
+G1 X107.003 Y129.171 E0.00872
+G1 X106.749 Y129.231 E0.00872
+G1 X106.493 Y129.289 E0.00872
+G1 X106.237 Y129.344 E0.00872
+G1 X105.981 Y129.398 E0.00872
+G1 X105.724 Y129.449 E0.00872
+G1 X105.467 Y129.498 E0.00872
+G1 X105.209 Y129.544 E0.00872
+G1 X104.951 Y129.589 E0.00872
+G1 X104.693 Y129.631 E0.00872
+G1 X104.434 Y129.670 E0.00872
+G1 X104.175 Y129.708 E0.00872
+G1 X103.916 Y129.743 E0.00872
+G1 X103.656 Y129.776 E0.00872
+G1 X103.396 Y129.807 E0.00872
+G1 X103.136 Y129.836 E0.00872
+G1 X102.875 Y129.862 E0.00872
+G1 X102.615 Y129.886 E0.00872
+G1 X102.354 Y129.908 E0.00872
+G1 X102.093 Y129.927 E0.00872
+G1 X101.831 Y129.944 E0.00872
+G1 X101.570 Y129.959 E0.00872
+G1 X101.309 Y129.971 E0.00872
+G1 X101.047 Y129.982 E0.00872
+G1 X100.785 Y129.990 E0.00872
+G1 X100.524 Y129.995 E0.00872
+G1 X100.262 Y129.999 E0.00872
+G1 X100.000 Y130.000 E0.00872
+G1 X99.738 Y129.999 E0.00872
+G1 X99.476 Y129.995 E0.00872
+G1 X99.215 Y129.990 E0.00872
+G1 X98.953 Y129.982 E0.00872
+G1 X98.691 Y129.971 E0.00872
+G1 X98.430 Y129.959 E0.00872
+G1 X98.169 Y129.944 E0.00872
+G1 X97.907 Y129.927 E0.00872
+G1 X97.646 Y129.908 E0.00872
+G1 X97.385 Y129.886 E0.00872
+G1 X97.125 Y129.862 E0.00872
+G1 X96.864 Y129.836 E0.00872
+G1 X96.604 Y129.807 E0.00872
+G1 X96.344 Y129.776 E0.00872
+G1 X96.084 Y129.743 E0.00872
+G1 X95.825 Y129.708 E0.00872
+G1 X95.566 Y129.670 E0.00872
+G1 X95.307 Y129.631 E0.00872
+G1 X95.049 Y129.589 E0.00872
+G1 X94.791 Y129.544 E0.00872
+G1 X94.533 Y129.498 E0.00872
+G1 X94.276 Y129.449 E0.00872
+G1 X94.019 Y129.398 E0.00872
+G1 X93.763 Y129.344 E0.00872
+G1 X93.507 Y129.289 E0.00872
+G1 X93.251 Y129.231 E0.00872
+G1 X92.997 Y129.171 E0.00872
+G1 X92.742 Y129.109 E0.00872
+G1 X92.489 Y129.044 E0.00872
+G1 X92.235 Y128.978 E0.00872
+G1 X91.983 Y128.909 E0.00872
+G1 X91.731 Y128.838 E0.00872
+G1 X91.480 Y128.765 E0.00872
+G1 X91.229 Y128.689 E0.00872
+G1 X90.979 Y128.612 E0.00872
+G1 X90.729 Y128.532 E0.00872
+G1 X90.481 Y128.450 E0.00872
+G1 X90.233 Y128.366 E0.00872
+G1 X89.986 Y128.279 E0.00872
+G1 X89.739 Y128.191 E0.00872
+G1 X89.494 Y128.100 E0.00872
+G1 X89.249 Y128.007 E0.00872
+G1 X89.005 Y127.913 E0.00872
+G1 X88.762 Y127.816 E0.00872
+G1 X88.519 Y127.716 E0.00872
+G1 X88.278 Y127.615 E0.00872
+G1 X88.038 Y127.512 E0.00872
+G1 X87.798 Y127.406 E0.00872
+G1 X87.559 Y127.299 E0.00872
+G1 X87.321 Y127.189 E0.00872
+G1 X87.085 Y127.078 E0.00872
+G1 X86.849 Y126.964 E0.00872
+G1 X86.614 Y126.848 E0.00872
+G1 X86.380 Y126.730 E0.00872
+G1 X86.148 Y126.610 E0.00872
+G1 X85.916 Y126.488 E0.00872
+G1 X85.685 Y126.365 E0.00872
+G1 X85.456 Y126.239 E0.00872
+G1 X85.227 Y126.111 E0.00872
+G1 X85.000 Y125.981 E0.00872
+G1 X84.774 Y125.849 E0.00872
+G1 X84.549 Y125.715 E0.00872
+G1 X84.325 Y125.579 E0.00872
+G1 X84.102 Y125.441 E0.00872
+G1 X83.881 Y125.302 E0.00872
+G1 X83.661 Y125.160 E0.00872
+G1 X83.442 Y125.017 E0.00872
+G1 X83.224 Y124.871 E0.00872
+G1 X83.008 Y124.724 E0.00872
+G1 X82.793 Y124.575 E0.00872
+G1 X82.579 Y124.423 E0.00872
+G1 X82.366 Y124.271 E0.00872
+G1 X82.155 Y124.116 E0.00872
+G1 X81.946 Y123.959 E0.00872
+G1 X81.737 Y123.801 E0.00872
+G1 X81.530 Y123.640 E0.00872
+G1 X81.325 Y123.478 E0.00872
+G1 X81.120 Y123.314 E0.00872
+G1 X80.918 Y123.149 E0.00872
+G1 X80.716 Y122.981 E0.00872
+G1 X80.517 Y122.812 E0.00872
+G1 X80.318 Y122.641 E0.00872
+G1 X80.121 Y122.469 E0.00872
+G1 X79.926 Y122.294 E0.00872
+G1 X79.732 Y122.118 E0.00872
+G1 X79.540 Y121.941 E0.00872
+G1 X79.349 Y121.761 E0.00872
+G1 X79.160 Y121.580 E0.00872
+G1 X78.973 Y121.398 E0.00872
+G1 X78.787 Y121.213 E0.00872
+G1 X78.602 Y121.027 E0.00872
+G1 X78.420 Y120.840 E0.00872
+G1 X78.239 Y120.651 E0.00872
+G1 X78.059 Y120.460 E0.00872
+G1 X77.882 Y120.268 E0.00872
+G1 X77.706 Y120.074 E0.00872
+G1 X77.531 Y119.879 E0.00872
+G1 X77.359 Y119.682 E0.00872
+G1 X77.188 Y119.483 E0.00872
+G1 X77.019 Y119.284 E0.00872
+G1 X76.851 Y119.082 E0.00872
+G1 X76.686 Y118.880 E0.00872
+G1 X76.522 Y118.675 E0.00872
+G1 X76.360 Y118.470 E0.00872
+G1 X76.199 Y118.263 E0.00872
+G1 X76.041 Y118.054 E0.00872
+G1 X75.884 Y117.845 E0.00872
+G1 X75.729 Y117.634 E0.00872
+G1 X75.577 Y117.421 E0.00872
+G1 X75.425 Y117.207 E0.00872
+G1 X75.276 Y116.992 E0.00872
+G1 X75.129 Y116.776 E0.00872
+G1 X74.983 Y116.558 E0.00872
+G1 X74.840 Y116.339 E0.00872
+G1 X74.698 Y116.119 E0.00872
+G1 X74.559 Y115.898 E0.00872
+G1 X74.421 Y115.675 E0.00872
+G1 X74.285 Y115.451 E0.00872
+G1 X74.151 Y115.226 E0.00872
+G1 X74.019 Y115.000 E0.00872
+G1 X73.889 Y114.773 E0.00872
+G1 X73.761 Y114.544 E0.00872
+G1 X73.635 Y114.315 E0.00872
+G1 X73.512 Y114.084 E0.00872
+G1 X73.390 Y113.852 E0.00872
+G1 X73.270 Y113.620 E0.00872
+G1 X73.152 Y113.386 E0.00872
+G1 X73.036 Y113.151 E0.00872
+G1 X72.922 Y112.915 E0.00872
+G1 X72.811 Y112.679 E0.00872
+G1 X72.701 Y112.441 E0.00872
+G1 X72.594 Y112.202 E0.00872
+G1 X72.488 Y111.962 E0.00872
+G1 X72.385 Y111.722 E0.00872
+G1 X72.284 Y111.481 E0.00872
+G1 X72.184 Y111.238 E0.00872
+G1 X72.087 Y110.995 E0.00872
+G1 X71.993 Y110.751 E0.00872
+G1 X71.900 Y110.506 E0.00872
+G1 X71.809 Y110.261 E0.00872
+G1 X71.721 Y110.014 E0.00872
+G1 X71.634 Y109.767 E0.00872
+G1 X71.550 Y109.519 E0.00872
+G1 X71.468 Y109.271 E0.00872
+G1 X71.388 Y109.021 E0.00872
+G1 X71.311 Y108.771 E0.00872
+G1 X71.235 Y108.520 E0.00872
+G1 X71.162 Y108.269 E0.00872
+G1 X71.091 Y108.017 E0.00872
+G1 X71.022 Y107.765 E0.00872
+G1 X70.956 Y107.511 E0.00872
+G1 X70.891 Y107.258 E0.00872
+G1 X70.829 Y107.003 E0.00872
+G1 X70.769 Y106.749 E0.00872
+G1 X70.711 Y106.493 E0.00872
+G1 X70.656 Y106.237 E0.00872
+G1 X70.602 Y105.981 E0.00872
+G1 X70.551 Y105.724 E0.00872
+G1 X70.502 Y105.467 E0.00872
+G1 X70.456 Y105.209 E0.00872
+G1 X70.411 Y104.951 E0.00872
+G1 X70.369 Y104.693 E0.00872
+G1 X70.330 Y104.434 E0.00872
+G1 X70.292 Y104.175 E0.00872
+G1 X70.257 Y103.916 E0.00872
+G1 X70.224 Y103.656 E0.00872
+G1 X70.193 Y103.396 E0.00872
+G1 X70.164 Y103.136 E0.00872
+G1 X70.138 Y102.875 E0.00872
+G1 X70.114 Y102.615 E0.00872
+G1 X70.092 Y102.354 E0.00872
+G1 X70.073 Y102.093 E0.00872
+G1 X70.056 Y101.831 E0.00872
+G1 X70.041 Y101.570 E0.00872
+G1 X70.029 Y101.309 E0.00872
+G1 X70.018 Y101.047 E0.00872
+G1 X70.010 Y100.785 E0.00872
+G1 X70.005 Y100.524 E0.00872
+G1 X70.001 Y100.262 E0.00872
+G1 X70.000 Y100.000 E0.00872
+G1 X70.001 Y99.738 E0.00872
+G1 X70.005 Y99.476 E0.00872
+G1 X70.010 Y99.215 E0.00872
+G1 X70.018 Y98.953 E0.00872
+G1 X70.029 Y98.691 E0.00872
+G1 X70.041 Y98.430 E0.00872
+G1 X70.056 Y98.169 E0.00872
+G1 X70.073 Y97.907 E0.00872
+G1 X70.092 Y97.646 E0.00872
+G1 X70.114 Y97.385 E0.00872
+G1 X70.138 Y97.125 E0.00872
+G1 X70.164 Y96.864 E0.00872
+G1 X70.193 Y96.604 E0.00872
+G1 X70.224 Y96.344 E0.00872
+G1 X70.257 Y96.084 E0.00872
+G1 X70.292 Y95.825 E0.00872
+G1 X70.330 Y95.566 E0.00872
+G1 X70.369 Y95.307 E0.00872
+G1 X70.411 Y95.049 E0.00872
+G1 X70.456 Y94.791 E0.00872
+G1 X70.502 Y94.533 E0.00872
+G1 X70.551 Y94.276 E0.00872
+G1 X70.602 Y94.019 E0.00872
+G1 X70.656 Y93.763 E0.00872
+G1 X70.711 Y93.507 E0.00872
+G1 X70.769 Y93.251 E0.00872
+G1 X70.829 Y92.997 E0.00872
+G1 X70.891 Y92.742 E0.00872
+G1 X70.956 Y92.489 E0.00872
+G1 X71.022 Y92.235 E0.00872
+G1 X71.091 Y91.983 E0.00872
+G1 X71.162 Y91.731 E0.00872
+G1 X71.235 Y91.480 E0.00872
+G1 X71.311 Y91.229 E0.00872
+G1 X71.388 Y90.979 E0.00872
+G1 X71.468 Y90.729 E0.00872
+G1 X71.550 Y90.481 E0.00872
+G1 X71.634 Y90.233 E0.00872
+G1 X71.721 Y89.986 E0.00872
+G1 X71.809 Y89.739 E0.00872
+G1 X71.900 Y89.494 E0.00872
+G1 X71.993 Y89.249 E0.00872
+G1 X72.087 Y89.005 E0.00872
+G1 X72.184 Y88.762 E0.00872
+G1 X72.284 Y88.519 E0.00872
+G1 X72.385 Y88.278 E0.00872
+G1 X72.488 Y88.038 E0.00872
+G1 X72.594 Y87.798 E0.00872
+G1 X72.701 Y87.559 E0.00872
+G1 X72.811 Y87.321 E0.00872
+G1 X72.922 Y87.085 E0.00872
+G1 X73.036 Y86.849 E0.00872
+G1 X73.152 Y86.614 E0.00872
+G1 X73.270 Y86.380 E0.00872
+G1 X73.390 Y86.148 E0.00872
+G1 X73.512 Y85.916 E0.00872
+G1 X73.635 Y85.685 E0.00872
+G1 X73.761 Y85.456 E0.00872
+G1 X73.889 Y85.227 E0.00872
+G1 X74.019 Y85.000 E0.00872
+G1 X74.151 Y84.774 E0.00872
+G1 X74.285 Y84.549 E0.00872
+G1 X74.421 Y84.325 E0.00872
+G1 X74.559 Y84.102 E0.00872
+G1 X74.698 Y83.881 E0.00872
+G1 X74.840 Y83.661 E0.00872
+G1 X74.983 Y83.442 E0.00872
+G1 X75.129 Y83.224 E0.00872
+G1 X75.276 Y83.008 E0.00872
+G1 X75.425 Y82.793 E0.00872
+G1 X75.577 Y82.579 E0.00872
+G1 X75.729 Y82.366 E0.00872
+G1 X75.884 Y82.155 E0.00872
+G1 X76.041 Y81.946 E0.00872
+G1 X76.199 Y81.737 E0.00872
+G1 X76.360 Y81.530 E0.00872
+G1 X76.522 Y81.325 E0.00872
+G1 X76.686 Y81.120 E0.00872
+G1 X76.851 Y80.918 E0.00872
+G1 X77.019 Y80.716 E0.00872
+G1 X77.188 Y80.517 E0.00872
+G1 X77.359 Y80.318 E0.00872
+G1 X77.531 Y80.121 E0.00872
+G1 X77.706 Y79.926 E0.00872
+G1 X77.882 Y79.732 E0.00872
+G1 X78.059 Y79.540 E0.00872
+G1 X78.239 Y79.349 E0.00872
+G1 X78.420 Y79.160 E0.00872
+G1 X78.602 Y78.973 E0.00872
+G1 X78.787 Y78.787 E0.00872
+G1 X78.973 Y78.602 E0.00872
+G1 X79.160 Y78.420 E0.00872
+G1 X79.349 Y78.239 E0.00872
+G1 X79.540 Y78.059 E0.00872
+G1 X79.732 Y77.882 E0.00872
+G1 X79.926 Y77.706 E0.00872
+G1 X80.121 Y77.531 E0.00872
+G1 X80.318 Y77.359 E0.00872
+G1 X80.517 Y77.188 E0.00872
+G1 X80.716 Y77.019 E0.00872
+G1 X80.918 Y76.851 E0.00872
+G1 X81.120 Y76.686 E0.00872
+G1 X81.325 Y76.522 E0.00872
+G1 X81.530 Y76.360 E0.00872
+G1 X81.737 Y76.199 E0.00872
+G1 X81.946 Y76.041 E0.00872
+G1 X82.155 Y75.884 E0.00872
+G1 X82.366 Y75.729 E0.00872
+G1 X82.579 Y75.577 E0.00872
+G1 X82.793 Y75.425 E0.00872
+G1 X83.008 Y75.276 E0.00872
+G1 X83.224 Y75.129 E0.00872
+G1 X83.442 Y74.983 E0.00872
+G1 X83.661 Y74.840 E0.00872
+G1 X83.881 Y74.698 E0.00872
+G1 X84.102 Y74.559 E0.00872
+G1 X84.325 Y74.421 E0.00872
+G1 X84.549 Y74.285 E0.00872
+G1 X84.774 Y74.151 E0.00872
+G1 X85.000 Y74.019 E0.00872
+G1 X85.227 Y73.889 E0.00872
+G1 X85.456 Y73.761 E0.00872
+G1 X85.685 Y73.635 E0.00872
+G1 X85.916 Y73.512 E0.00872
+G1 X86.148 Y73.390 E0.00872
+G1 X86.380 Y73.270 E0.00872
+G1 X86.614 Y73.152 E0.00872
+G1 X86.849 Y73.036 E0.00872
+G1 X87.085 Y72.922 E0.00872
+G1 X87.321 Y72.811 E0.00872
+G1 X87.559 Y72.701 E0.00872
+G1 X87.798 Y72.594 E0.00872
+G1 X88.038 Y72.488 E0.00872
+G1 X88.278 Y72.385 E0.00872
+G1 X88.519 Y72.284 E0.00872
+G1 X88.762 Y72.184 E0.00872
+G1 X89.005 Y72.087 E0.00872
+G1 X89.249 Y71.993 E0.00872
+G1 X89.494 Y71.900 E0.00872
+G1 X89.739 Y71.809 E0.00872
+G1 X89.986 Y71.721 E0.00872
+G1 X90.233 Y71.634 E0.00872
+G1 X90.481 Y71.550 E0.00872
+G1 X90.729 Y71.468 E0.00872
+G1 X90.979 Y71.388 E0.00872
+G1 X91.229 Y71.311 E0.00872
+G1 X91.480 Y71.235 E0.00872
+G1 X91.731 Y71.162 E0.00872
+G1 X91.983 Y71.091 E0.00872
+G1 X92.235 Y71.022 E0.00872
+G1 X92.489 Y70.956 E0.00872
+G1 X92.742 Y70.891 E0.00872
+G1 X92.997 Y70.829 E0.00872
+G1 X93.251 Y70.769 E0.00872
+G1 X93.507 Y70.711 E0.00872
+G1 X93.763 Y70.656 E0.00872
+G1 X94.019 Y70.602 E0.00872
+G1 X94.276 Y70.551 E0.00872
+G1 X94.533 Y70.502 E0.00872
+G1 X94.791 Y70.456 E0.00872
+G1 X95.049 Y70.411 E0.00872
+G1 X95.307 Y70.369 E0.00872
+G1 X95.566 Y70.330 E0.00872
+G1 X95.825 Y70.292 E0.00872
+G1 X96.084 Y70.257 E0.00872
+G1 X96.344 Y70.224 E0.00872
+G1 X96.604 Y70.193 E0.00872
+G1 X96.864 Y70.164 E0.00872
+G1 X97.125 Y70.138 E0.00872
+G1 X97.385 Y70.114 E0.00872
+G1 X97.646 Y70.092 E0.00872
+G1 X97.907 Y70.073 E0.00872
+G1 X98.169 Y70.056 E0.00872
+G1 X98.430 Y70.041 E0.00872
+G1 X98.691 Y70.029 E0.00872
+G1 X98.953 Y70.018 E0.00872
+G1 X99.215 Y70.010 E0.00872
+G1 X99.476 Y70.005 E0.00872
+G1 X99.738 Y70.001 E0.00872
+G1 X100.000 Y70.000 E0.00872
+G1 X100.262 Y70.001 E0.00872
+G1 X100.524 Y70.005 E0.00872
+G1 X100.785 Y70.010 E0.00872
+G1 X101.047 Y70.018 E0.00872
+G1 X101.309 Y70.029 E0.00872
+G1 X101.570 Y70.041 E0.00872
+G1 X101.831 Y70.056 E0.00872
+G1 X102.093 Y70.073 E0.00872
+G1 X102.354 Y70.092 E0.00872
+G1 X102.615 Y70.114 E0.00872
+G1 X102.875 Y70.138 E0.00872
+G1 X103.136 Y70.164 E0.00872
+G1 X103.396 Y70.193 E0.00872
+G1 X103.656 Y70.224 E0.00872
+G1 X103.916 Y70.257 E0.00872
+G1 X104.175 Y70.292 E0.00872
+G1 X104.434 Y70.330 E0.00872
+G1 X104.693 Y70.369 E0.00872
+G1 X104.951 Y70.411 E0.00872
+G1 X105.209 Y70.456 E0.00872
+G1 X105.467 Y70.502 E0.00872
+G1 X105.724 Y70.551 E0.00872
+G1 X105.981 Y70.602 E0.00872
+G1 X106.237 Y70.656 E0.00872
+G1 X106.493 Y70.711 E0.00872
+G1 X106.749 Y70.769 E0.00872
+G1 X107.003 Y70.829 E0.00872
+G1 X107.258 Y70.891 E0.00872
+G1 X107.511 Y70.956 E0.00872
+G1 X107.765 Y71.022 E0.00872
+G1 X108.017 Y71.091 E0.00872
+G1 X108.269 Y71.162 E0.00872
+G1 X108.520 Y71.235 E0.00872
+G1 X108.771 Y71.311 E0.00872
+G1 X109.021 Y71.388 E0.00872
+G1 X109.271 Y71.468 E0.00872
+G1 X109.519 Y71.550 E0.00872
+G1 X109.767 Y71.634 E0.00872
+G1 X110.014 Y71.721 E0.00872
+G1 X110.261 Y71.809 E0.00872
+G1 X110.506 Y71.900 E0.00872
+G1 X110.751 Y71.993 E0.00872
+G1 X110.995 Y72.087 E0.00872
+G1 X111.238 Y72.184 E0.00872
+G1 X111.481 Y72.284 E0.00872
+G1 X111.722 Y72.385 E0.00872
+G1 X111.962 Y72.488 E0.00872
+G1 X112.202 Y72.594 E0.00872
+G1 X112.441 Y72.701 E0.00872
+G1 X112.679 Y72.811 E0.00872
+G1 X112.915 Y72.922 E0.00872
+G1 X113.151 Y73.036 E0.00872
+G1 X113.386 Y73.152 E0.00872
+G1 X113.620 Y73.270 E0.00872
+G1 X113.852 Y73.390 E0.00872
+G1 X114.084 Y73.512 E0.00872
+G1 X114.315 Y73.635 E0.00872
+G1 X114.544 Y73.761 E0.00872
+G1 X114.773 Y73.889 E0.00872
+G1 X115.000 Y74.019 E0.00872
+G1 X115.226 Y74.151 E0.00872
+G1 X115.451 Y74.285 E0.00872
+G1 X115.675 Y74.421 E0.00872
+G1 X115.898 Y74.559 E0.00872
+G1 X116.119 Y74.698 E0.00872
+G1 X116.339 Y74.840 E0.00872
+G1 X116.558 Y74.983 E0.00872
+G1 X116.776 Y75.129 E0.00872
+G1 X116.992 Y75.276 E0.00872
+G1 X117.207 Y75.425 E0.00872
+G1 X117.421 Y75.577 E0.00872
+G1 X117.634 Y75.729 E0.00872
+G1 X117.845 Y75.884 E0.00872
+G1 X118.054 Y76.041 E0.00872
+G1 X118.263 Y76.199 E0.00872
+G1 X118.470 Y76.360 E0.00872
+G1 X118.675 Y76.522 E0.00872
+G1 X118.880 Y76.686 E0.00872
+G1 X119.082 Y76.851 E0.00872
+G1 X119.284 Y77.019 E0.00872
+G1 X119.483 Y77.188 E0.00872
+G1 X119.682 Y77.359 E0.00872
+G1 X119.879 Y77.531 E0.00872
+G1 X120.074 Y77.706 E0.00872
+G1 X120.268 Y77.882 E0.00872
+G1 X120.460 Y78.059 E0.00872
+G1 X120.651 Y78.239 E0.00872
+G1 X120.840 Y78.420 E0.00872
+G1 X121.027 Y78.602 E0.00872
+G1 X121.213 Y78.787 E0.00872
+G1 X121.398 Y78.973 E0.00872
+G1 X121.580 Y79.160 E0.00872
+G1 X121.761 Y79.349 E0.00872
+G1 X121.941 Y79.540 E0.00872
+G1 X122.118 Y79.732 E0.00872
+G1 X122.294 Y79.926 E0.00872
+G1 X122.469 Y80.121 E0.00872
+G1 X122.641 Y80.318 E0.00872
+G1 X122.812 Y80.517 E0.00872
+G1 X122.981 Y80.716 E0.00872
+G1 X123.149 Y80.918 E0.00872
+G1 X123.314 Y81.120 E0.00872
+G1 X123.478 Y81.325 E0.00872
+G1 X123.640 Y81.530 E0.00872
+G1 X123.801 Y81.737 E0.00872
+G1 X123.959 Y81.946 E0.00872
+G1 X124.116 Y82.155 E0.00872
+G1 X124.271 Y82.366 E0.00872
+G1 X124.423 Y82.579 E0.00872
+G1 X124.575 Y82.793 E0.00872
+G1 X124.724 Y83.008 E0.00872
+G1 X124.871 Y83.224 E0.00872
+G1 X125.017 Y83.442 E0.00872
+G1 X125.160 Y83.661 E0.00872
+G1 X125.302 Y83.881 E0.00872
+G1 X125.441 Y84.102 E0.00872
+G1 X125.579 Y84.325 E0.00872
+G1 X125.715 Y84.549 E0.00872
+G1 X125.849 Y84.774 E0.00872
+G1 X125.981 Y85.000 E0.00872
+G1 X126.111 Y85.227 E0.00872
+G1 X126.239 Y85.456 E0.00872
+G1 X126.365 Y85.685 E0.00872
+G1 X126.488 Y85.916 E0.00872
+G1 X126.610 Y86.148 E0.00872
+G1 X126.730 Y86.380 E0.00872
+G1 X126.848 Y86.614 E0.00872
+G1 X126.964 Y86.849 E0.00872
+G1 X127.078 Y87.085 E0.00872
+G1 X127.189 Y87.321 E0.00872
+G1 X127.299 Y87.559 E0.00872
+G1 X127.406 Y87.798 E0.00872
+G1 X127.512 Y88.038 E0.00872
+G1 X127.615 Y88.278 E0.00872
+G1 X127.716 Y88.519 E0.00872
+G1 X127.816 Y88.762 E0.00872
+G1 X127.913 Y89.005 E0.00872
+G1 X128.007 Y89.249 E0.00872
+G1 X128.100 Y89.494 E0.00872
+G1 X128.191 Y89.739 E0.00872
+G1 X128.279 Y89.986 E0.00872
+G1 X128.366 Y90.233 E0.00872
+G1 X128.450 Y90.481 E0.00872
+G1 X128.532 Y90.729 E0.00872
+G1 X128.612 Y90.979 E0.00872
+G1 X128.689 Y91.229 E0.00872
+G1 X128.765 Y91.480 E0.00872
+G1 X128.838 Y91.731 E0.00872
+G1 X128.909 Y91.983 E0.00872
+G1 X128.978 Y92.235 E0.00872
+G1 X129.044 Y92.489 E0.00872
+G1 X129.109 Y92.742 E0.00872
+G1 X129.171 Y92.997 E0.00872
+G1 X129.231 Y93.251 E0.00872
+G1 X129.289 Y93.507 E0.00872
+G1 X129.344 Y93.763 E0.00872
+G1 X129.398 Y94.019 E0.00872
+G1 X129.449 Y94.276 E0.00872
+G1 X129.498 Y94.533 E0.00872
+G1 X129.544 Y94.791 E0.00872
+G1 X129.589 Y95.049 E0.00872
+G1 X129.631 Y95.307 E0.00872
+G1 X129.670 Y95.566 E0.00872
+G1 X129.708 Y95.825 E0.00872
+G1 X129.743 Y96.084 E0.00872
+G1 X129.776 Y96.344 E0.00872
+G1 X129.807 Y96.604 E0.00872
+G1 X129.836 Y96.864 E0.00872
+G1 X129.862 Y97.125 E0.00872
+G1 X129.886 Y97.385 E0.00872
+G1 X129.908 Y97.646 E0.00872
+G1 X129.927 Y97.907 E0.00872
+G1 X129.944 Y98.169 E0.00872
+G1 X129.959 Y98.430 E0.00872
+G1 X129.971 Y98.691 E0.00872
+G1 X129.982 Y98.953 E0.00872
+G1 X129.990 Y99.215 E0.00872
+G1 X129.995 Y99.476 E0.00872
+G1 X129.999 Y99.738 E0.00872
+G1 X130.000 Y100.000 E0.00872
+
+; Collinear run split into 0.5mm pieces
+G0 X40 Y40 F9000
+G1 X40.500 Y40 E0.01665
+G1 X41.000 Y40 E0.01665
+G1 X41.500 Y40 E0.01665
+G1 X42.000 Y40 E0.01665
+G1 X42.500 Y40 E0.01665
+G1 X43.000 Y40 E0.01665
+G1 X43.500 Y40 E0.01665
+G1 X44.000 Y40 E0.01665
+G1 X44.500 Y40 E0.01665
+G1 X45.000 Y40 E0.01665
+G1 X45.500 Y40 E0.01665
+G1 X46.000 Y40 E0.01665
+G1 X46.500 Y40 E0.01665
+G1 X47.000 Y40 E0.01665
+G1 X47.500 Y40 E0.01665
+G1 X48.000 Y40 E0.01665
+G1 X48.500 Y40 E0.01665
+G1 X49.000 Y40 E0.01665
+G1 X49.500 Y40 E0.01665
+G1 X50.000 Y40 E0.01665
+G1 X50.500 Y40 E0.01665
+G1 X51.000 Y40 E0.01665
+G1 X51.500 Y40 E0.01665
+G1 X52.000 Y40 E0.01665
+G1 X52.500 Y40 E0.01665
+G1 X53.000 Y40 E0.01665
+G1 X53.500 Y40 E0.01665
+G1 X54.000 Y40 E0.01665
+G1 X54.500 Y40 E0.01665
+G1 X55.000 Y40 E0.01665
+G1 X55.500 Y40 E0.01665
+G1 X56.000 Y40 E0.01665
+G1 X56.500 Y40 E0.01665
+G1 X57.000 Y40 E0.01665
+G1 X57.500 Y40 E0.01665
+G1 X58.000 Y40 E0.01665
+G1 X58.500 Y40 E0.01665
+G1 X59.000 Y40 E0.01665
+G1 X59.500 Y40 E0.01665
+G1 X60.000 Y40 E0.01665
+G1 X60.500 Y40 E0.01665
+G1 X61.000 Y40 E0.01665
+G1 X61.500 Y40 E0.01665
+G1 X62.000 Y40 E0.01665
+G1 X62.500 Y40 E0.01665
+G1 X63.000 Y40 E0.01665
+G1 X63.500 Y40 E0.01665
+G1 X64.000 Y40 E0.01665
+G1 X64.500 Y40 E0.01665
+G1 X65.000 Y40 E0.01665
+G1 X65.500 Y40 E0.01665
+G1 X66.000 Y40 E0.01665
+G1 X66.500 Y40 E0.01665
+G1 X67.000 Y40 E0.01665
+G1 X67.500 Y40 E0.01665
+G1 X68.000 Y40 E0.01665
+G1 X68.500 Y40 E0.01665
+G1 X69.000 Y40 E0.01665
+G1 X69.500 Y40 E0.01665
+G1 X70.000 Y40 E0.01665
+G1 X70.500 Y40 E0.01665
+G1 X71.000 Y40 E0.01665
+G1 X71.500 Y40 E0.01665
+G1 X72.000 Y40 E0.01665
+G1 X72.500 Y40 E0.01665
+G1 X73.000 Y40 E0.01665
+G1 X73.500 Y40 E0.01665
+G1 X74.000 Y40 E0.01665
+G1 X74.500 Y40 E0.01665
+G1 X75.000 Y40 E0.01665
+G1 X75.500 Y40 E0.01665
+G1 X76.000 Y40 E0.01665
+G1 X76.500 Y40 E0.01665
+G1 X77.000 Y40 E0.01665
+G1 X77.500 Y40 E0.01665
+G1 X78.000 Y40 E0.01665
+G1 X78.500 Y40 E0.01665
+G1 X79.000 Y40 E0.01665
+G1 X79.500 Y40 E0.01665
+G1 X80.000 Y40 E0.01665
+G1 X80.500 Y40 E0.01665
+G1 X81.000 Y40 E0.01665
+G1 X81.500 Y40 E0.01665
+G1 X82.000 Y40 E0.01665
+G1 X82.500 Y40 E0.01665
+G1 X83.000 Y40 E0.01665
+G1 X83.500 Y40 E0.01665
+G1 X84.000 Y40 E0.01665
+G1 X84.500 Y40 E0.01665
+G1 X85.000 Y40 E0.01665
+G1 X85.500 Y40 E0.01665
+G1 X86.000 Y40 E0.01665
+G1 X86.500 Y40 E0.01665
+G1 X87.000 Y40 E0.01665
+G1 X87.500 Y40 E0.01665
+G1 X88.000 Y40 E0.01665
+G1 X88.500 Y40 E0.01665
+G1 X89.000 Y40 E0.01665
+G1 X89.500 Y40 E0.01665
+G1 X90.000 Y40 E0.01665
+G1 X90.500 Y40 E0.01665
+G1 X91.000 Y40 E0.01665
+G1 X91.500 Y40 E0.01665
+G1 X92.000 Y40 E0.01665
+G1 X92.500 Y40 E0.01665
+G1 X93.000 Y40 E0.01665
+G1 X93.500 Y40 E0.01665
+G1 X94.000 Y40 E0.01665
+G1 X94.500 Y40 E0.01665
+G1 X95.000 Y40 E0.01665
+G1 X95.500 Y40 E0.01665
+G1 X96.000 Y40 E0.01665
+G1 X96.500 Y40 E0.01665
+G1 X97.000 Y40 E0.01665
+G1 X97.500 Y40 E0.01665
+G1 X98.000 Y40 E0.01665
+G1 X98.500 Y40 E0.01665
+G1 X99.000 Y40 E0.01665
+G1 X99.500 Y40 E0.01665
+G1 X100.000 Y40 E0.01665
+G1 X100.500 Y40 E0.01665
+G1 X101.000 Y40 E0.01665
+G1 X101.500 Y40 E0.01665
+G1 X102.000 Y40 E0.01665
+G1 X102.500 Y40 E0.01665
+G1 X103.000 Y40 E0.01665
+G1 X103.500 Y40 E0.01665
+G1 X104.000 Y40 E0.01665
+G1 X104.500 Y40 E0.01665
+G1 X105.000 Y40 E0.01665
+G1 X105.500 Y40 E0.01665
+G1 X106.000 Y40 E0.01665
+G1 X106.500 Y40 E0.01665
+G1 X107.000 Y40 E0.01665
+G1 X107.500 Y40 E0.01665
+G1 X108.000 Y40 E0.01665
+G1 X108.500 Y40 E0.01665
+G1 X109.000 Y40 E0.01665
+G1 X109.500 Y40 E0.01665
+G1 X110.000 Y40 E0.01665
+G1 X110.500 Y40 E0.01665
+G1 X111.000 Y40 E0.01665
+G1 X111.500 Y40 E0.01665
+G1 X112.000 Y40 E0.01665
+G1 X112.500 Y40 E0.01665
+G1 X113.000 Y40 E0.01665
+G1 X113.500 Y40 E0.01665
+G1 X114.000 Y40 E0.01665
+G1 X114.500 Y40 E0.01665
+G1 X115.000 Y40 E0.01665
+G1 X115.500 Y40 E0.01665
+G1 X116.000 Y40 E0.01665
+G1 X116.500 Y40 E0.01665
+G1 X117.000 Y40 E0.01665
+G1 X117.500 Y40 E0.01665
+G1 X118.000 Y40 E0.01665
+G1 X118.500 Y40 E0.01665
+G1 X119.000 Y40 E0.01665
+G1 X119.500 Y40 E0.01665
+G1 X120.000 Y40 E0.01665
+G1 X120.500 Y40 E0.01665
+G1 X121.000 Y40 E0.01665
+G1 X121.500 Y40 E0.01665
+G1 X122.000 Y40 E0.01665
+G1 X122.500 Y40 E0.01665
+G1 X123.000 Y40 E0.01665
+G1 X123.500 Y40 E0.01665
+G1 X124.000 Y40 E0.01665
+G1 X124.500 Y40 E0.01665
+G1 X125.000 Y40 E0.01665
+G1 X125.500 Y40 E0.01665
+G1 X126.000 Y40 E0.01665
+G1 X126.500 Y40 E0.01665
+G1 X127.000 Y40 E0.01665
+G1 X127.500 Y40 E0.01665
+G1 X128.000 Y40 E0.01665
+G1 X128.500 Y40 E0.01665
+G1 X129.000 Y40 E0.01665
+G1 X129.500 Y40 E0.01665
+G1 X130.000 Y40 E0.01665
+G1 X130.500 Y40 E0.01665
+G1 X131.000 Y40 E0.01665
+G1 X131.500 Y40 E0.01665
+G1 X132.000 Y40 E0.01665
+G1 X132.500 Y40 E0.01665
+G1 X133.000 Y40 E0.01665
+G1 X133.500 Y40 E0.01665
+G1 X134.000 Y40 E0.01665
+G1 X134.500 Y40 E0.01665
+G1 X135.000 Y40 E0.01665
+G1 X135.500 Y40 E0.01665
+G1 X136.000 Y40 E0.01665
+G1 X136.500 Y40 E0.01665
+G1 X137.000 Y40 E0.01665
+G1 X137.500 Y40 E0.01665
+G1 X138.000 Y40 E0.01665
+G1 X138.500 Y40 E0.01665
+G1 X139.000 Y40 E0.01665
+G1 X139.500 Y40 E0.01665
+G1 X140.000 Y40 E0.01665
+G1 X140.500 Y40 E0.01665
+G1 X141.000 Y40 E0.01665
+G1 X141.500 Y40 E0.01665
+G1 X142.000 Y40 E0.01665
+G1 X142.500 Y40 E0.01665
+G1 X143.000 Y40 E0.01665
+G1 X143.500 Y40 E0.01665
+G1 X144.000 Y40 E0.01665
+G1 X144.500 Y40 E0.01665
+G1 X145.000 Y40 E0.01665
+G1 X145.500 Y40 E0.01665
+G1 X146.000 Y40 E0.01665
+G1 X146.500 Y40 E0.01665
+G1 X147.000 Y40 E0.01665
+G1 X147.500 Y40 E0.01665
+G1 X148.000 Y40 E0.01665
+G1 X148.500 Y40 E0.01665
+G1 X149.000 Y40 E0.01665
+G1 X149.500 Y40 E0.01665
+G1 X150.000 Y40 E0.01665
+G1 X150.500 Y40 E0.01665
+G1 X151.000 Y40 E0.01665
+G1 X151.500 Y40 E0.01665
+G1 X152.000 Y40 E0.01665
+G1 X152.500 Y40 E0.01665
+G1 X153.000 Y40 E0.01665
+G1 X153.500 Y40 E0.01665
+G1 X154.000 Y40 E0.01665
+G1 X154.500 Y40 E0.01665
+G1 X155.000 Y40 E0.01665
+G1 X155.500 Y40 E0.01665
+G1 X156.000 Y40 E0.01665
+G1 X156.500 Y40 E0.01665
+G1 X157.000 Y40 E0.01665
+G1 X157.500 Y40 E0.01665
+G1 X158.000 Y40 E0.01665
+G1 X158.500 Y40 E0.01665
+G1 X159.000 Y40 E0.01665
+G1 X159.500 Y40 E0.01665
+G1 X160.000 Y40 E0.01665
+
+; Zigzag infill with short lines
+G1 X60 Y50.0 E2.66400
+G1 Y50.4 E0.01332
+G1 X140 Y50.4 E2.66400
+G1 Y50.8 E0.01332
+G1 X60 Y50.8 E2.66400
+G1 Y51.2 E0.01332
+G1 X140 Y51.2 E2.66400
+G1 Y51.6 E0.01332
+G1 X60 Y51.6 E2.66400
+G1 Y52.0 E0.01332
+G1 X140 Y52.0 E2.66400
+G1 Y52.4 E0.01332
+G1 X60 Y52.4 E2.66400
+G1 Y52.8 E0.01332
+G1 X140 Y52.8 E2.66400
+G1 Y53.2 E0.01332
+G1 X60 Y53.2 E2.66400
+G1 Y53.6 E0.01332
+G1 X140 Y53.6 E2.66400
+G1 Y54.0 E0.01332
+G1 X60 Y54.0 E2.66400
+G1 Y54.4 E0.01332
+G1 X140 Y54.4 E2.66400
+G1 Y54.8 E0.01332
+G1 X60 Y54.8 E2.66400
+G1 Y55.2 E0.01332
+G1 X140 Y55.2 E2.66400
+G1 Y55.6 E0.01332
+G1 X60 Y55.6 E2.66400
+G1 Y56.0 E0.01332
+G1 X140 Y56.0 E2.66400
+G1 Y56.4 E0.01332
+G1 X60 Y56.4 E2.66400
+G1 Y56.8 E0.01332
+G1 X140 Y56.8 E2.66400
+G1 Y57.2 E0.01332
+G1 X60 Y57.2 E2.66400
+G1 Y57.6 E0.01332
+G1 X140 Y57.6 E2.66400
+G1 Y58.0 E0.01332
+G1 X60 Y58.0 E2.66400
+G1 Y58.4 E0.01332
+G1 X140 Y58.4 E2.66400
+G1 Y58.8 E0.01332
+G1 X60 Y58.8 E2.66400
+G1 Y59.2 E0.01332
+G1 X140 Y59.2 E2.66400
+G1 Y59.6 E0.01332
+G1 X60 Y59.6 E2.66400
+G1 Y60.0 E0.01332
+G1 X140 Y60.0 E2.66400
+G1 Y60.4 E0.01332
+G1 X60 Y60.4 E2.66400
+G1 Y60.8 E0.01332
+G1 X140 Y60.8 E2.66400
+G1 Y61.2 E0.01332
+G1 X60 Y61.2 E2.66400
+G1 Y61.6 E0.01332
+G1 X140 Y61.6 E2.66400
+G1 Y62.0 E0.01332
+G1 X60 Y62.0 E2.66400
+G1 Y62.4 E0.01332
+G1 X140 Y62.4 E2.66400
+G1 Y62.8 E0.01332
+G1 X60 Y62.8 E2.66400
+G1 Y63.2 E0.01332
+G1 X140 Y63.2 E2.66400
+G1 Y63.6 E0.01332
+G1 X60 Y63.6 E2.66400
+G1 Y64.0 E0.01332
+G1 X140 Y64.0 E2.66400
+G1 Y64.4 E0.01332
+G1 X60 Y64.4 E2.66400
+G1 Y64.8 E0.01332
+G1 X140 Y64.8 E2.66400
+G1 Y65.2 E0.01332
+G1 X60 Y65.2 E2.66400
+G1 Y65.6 E0.01332
+G1 X140 Y65.6 E2.66400
+G1 Y66.0 E0.01332
+G1 X60 Y66.0 E2.66400
+G1 Y66.4 E0.01332
+G1 X140 Y66.4 E2.66400
+G1 Y66.8 E0.01332
+G1 X60 Y66.8 E2.66400
+G1 Y67.2 E0.01332
+G1 X140 Y67.2 E2.66400
+G1 Y67.6 E0.01332
+G1 X60 Y67.6 E2.66400
+G1 Y68.0 E0.01332
+G1 X140 Y68.0 E2.66400
+G1 Y68.4 E0.01332
+G1 X60 Y68.4 E2.66400
+G1 Y68.8 E0.01332
+G1 X140 Y68.8 E2.66400
+G1 Y69.2 E0.01332
+G1 X60 Y69.2 E2.66400
+G1 Y69.6 E0.01332
+G1 X140 Y69.6 E2.66400
+G1 Y70.0 E0.01332
+G1 X60 Y70.0 E2.66400
+G1 Y70.4 E0.01332
+G1 X140 Y70.4 E2.66400
+G1 Y70.8 E0.01332
+G1 X60 Y70.8 E2.66400
+G1 Y71.2 E0.01332
+G1 X140 Y71.2 E2.66400
+G1 Y71.6 E0.01332
+G1 X60 Y71.6 E2.66400
+G1 Y72.0 E0.01332
+G1 X140 Y72.0 E2.66400
+G1 Y72.4 E0.01332
+G1 X60 Y72.4 E2.66400
+G1 Y72.8 E0.01332
+G1 X140 Y72.8 E2.66400
+G1 Y73.2 E0.01332
+G1 X60 Y73.2 E2.66400
+G1 Y73.6 E0.01332
+G1 X140 Y73.6 E2.66400
+G1 Y74.0 E0.01332
+
+; Long travel moves
+G0 X20 Y20 F9000
+G0 X180 Y20 F9000
+G0 X180 Y180 F9000
+G0 X20 Y180 F9000
+G0 X100 Y100 F9000
+M400
@@ -0,0 +1,110 @@
+;
+;  Hotend temperature through a sudden rise in extrusion rate
+;  Run with: marlin --benchmark --verbose buildroot/test-gcode/extrusion-surge.gcode
+;
+;  Slow perimeters at 1mm/s of filament switch to fast infill at 8mm/s, then back.
+;  Compare the temperature reports with MPC_FEEDFORWARD_LEAD enabled and disabled.
+;
+G21 ; millimeters
+G90 ; absolute positioning
+M83 ; relative extrusion
+G92 X100 Y100 Z0.2
+M109 S210
+G4 S60             ; Settle
+M155 S1            ; Report temperatures every second
+; Perimeters: 20mm/s, 0.05mm filament per mm
+G1 X50 E5.00 F1200
+G1 X150 E5.00 F1200
+G1 X50 E5.00 F1200
+G1 X150 E5.00 F1200
+G1 X50 E5.00 F1200
+G1 X150 E5.00 F1200
+G1 X50 E5.00 F1200
+G1 X150 E5.00 F1200
+G1 X50 E5.00 F1200
+G1 X150 E5.00 F1200
+G1 X50 E5.00 F1200
+G1 X150 E5.00 F1200
+G1 X50 E5.00 F1200
+G1 X150 E5.00 F1200
+G1 X50 E5.00 F1200
+; Infill: 100mm/s, 0.08mm filament per mm
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+G1 X150 E8.00 F6000
+G1 X50 E8.00 F6000
+; Perimeters again
+G1 X150 E5.00 F1200
+G1 X50 E5.00 F1200
+G1 X150 E5.00 F1200
+G1 X50 E5.00 F1200
+G1 X150 E5.00 F1200
+G1 X50 E5.00 F1200
+G1 X150 E5.00 F1200
+G1 X50 E5.00 F1200
+G1 X150 E5.00 F1200
+G1 X50 E5.00 F1200
+G1 X150 E5.00 F1200
+G1 X50 E5.00 F1200
+G1 X150 E5.00 F1200
+G1 X50 E5.00 F1200
+G1 X150 E5.00 F1200
+M400
+M155 S0
+M104 S0
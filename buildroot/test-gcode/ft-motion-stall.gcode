@@ -0,0 +1,30 @@
+;
+;  Fixed-Time Motion with a blocked main loop
+;  Run with: marlin --benchmark --stall 500 buildroot/test-gcode/ft-motion-stall.gcode
+;
+;  The main loop stops for 500ms after each command, as a slow SD read or display update
+;  would. Without FTM_TIMER_TASK the stepper commands are made in idle(), so the stepper
+;  runs dry during each stall. Compare the FT_MOTION underruns with it enabled and disabled.
+;
+G21 ; millimeters
+G90 ; absolute positioning
+M83 ; relative extrusion
+M302 P1 ; allow cold extrusion on the simulator
+M493 S10 A40 B40 ; ZV shaping
+G92 X50 Y50 Z0.2
+G1 F6000
+G1 X150 Y50 E3
+G1 X150 Y150 E3
+G1 X50 Y150 E3
+G1 X50 Y50 E3
+G1 X150 Y150 E4.2
+G1 X50 Y150 E3
+G1 X150 Y50 E4.2
+G1 X50 Y50 E3
+G1 X100 Y60 F3000 E1.5
+G1 X140 Y100 E1.7
+G1 X100 Y140 E1.7
+G1 X60 Y100 E1.7
+G1 X100 Y60 E1.7
+M400
+M493
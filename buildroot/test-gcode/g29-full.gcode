@@ -0,0 +1,8 @@
+;
+;  Bed probing benchmark: G29 probing every point of the grid
+;  Run with: marlin --benchmark --surface bow=0.05,tilt_x=0.002
+;                   buildroot/test-gcode/g29-full.gcode buildroot/test-gcode/g29-adaptive.gcode
+;  Compare the time, Z min triggers and mesh error with g29-adaptive.gcode.
+;
+G28
+G29 U0
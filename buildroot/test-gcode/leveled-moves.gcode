@@ -0,0 +1,40 @@
+;
+;  Leveled move benchmark: long moves over a bilinear or mesh bed leveling grid
+;  Run with: marlin --benchmark buildroot/test-gcode/leveled-moves.gcode
+;  (M420 S2 makes up a random mesh and needs MARLIN_DEV_MODE)
+;
+G21 ; millimeters
+G90 ; absolute positioning
+M83 ; relative extrusion
+M302 P1 ; allow cold extrusion on the simulator
+G92 X5 Y5 Z0.2
+M420 S2
+M420 S1
+G1 F6000
+
+; Perimeter of the bed, along X and Y
+G1 X195 Y5 E4
+G1 X195 Y195 E4
+G1 X5 Y195 E4
+G1 X5 Y5 E4
+
+; Raster along X
+G1 X195 Y40 E4
+G1 X5 Y75 E4
+G1 X195 Y110 E4
+G1 X5 Y145 E4
+G1 X195 Y180 E4
+G1 Y40
+G1 X5 E4
+G1 Y75
+G1 X195 E4
+G1 Y110
+G1 X5 E4
+G1 Y145
+G1 X195 E4
+
+; Diagonals
+G1 X5 Y5 E4
+G1 X195 Y195 E4
+G1 X5 Y100 E4
+M400
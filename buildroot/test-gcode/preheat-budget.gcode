@@ -0,0 +1,16 @@
+;
+;  Preheat two hotends and the bed together under HEATER_POWER_BUDGET
+;  Run with: marlin --benchmark buildroot/test-gcode/preheat-budget.gcode buildroot/test-gcode/preheat-sequential.gcode
+;
+;  All heaters start at once and the budget shares the power out between them.
+;  Compare the virtual time and peak heater power with preheat-sequential.gcode.
+;
+M155 S5            ; Report temperatures and watts every 5 seconds
+M304 P165.81 I31.40 D583.66 ; Bed PID tuned (M303 E-1) for the simulated bed
+M140 S60
+M104 T0 S200
+M104 T1 S200
+M190 S60
+M109 T0 S200
+M109 T1 S200
+M155 S0
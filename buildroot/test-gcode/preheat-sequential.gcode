@@ -0,0 +1,13 @@
+;
+;  Preheat two hotends and the bed one at a time
+;  Run with: marlin --benchmark buildroot/test-gcode/preheat-budget.gcode buildroot/test-gcode/preheat-sequential.gcode
+;
+;  The usual way to stay within a small power supply without HEATER_POWER_BUDGET:
+;  each heater waits for the one before it. Start all heaters cold.
+;
+M155 S5            ; Report temperatures and watts every 5 seconds
+M304 P165.81 I31.40 D583.66 ; Bed PID tuned (M303 E-1) for the simulated bed
+M190 S60
+M109 T0 S200
+M109 T1 S200
+M155 S0
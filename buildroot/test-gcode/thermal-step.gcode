@@ -0,0 +1,24 @@
+;
+;  Heater step response and autotune against the simulated thermal model
+;  Run with: marlin --benchmark buildroot/test-gcode/thermal-step.gcode
+;
+;  The firmware runs in virtual time, so each dwell takes a fraction of a second.
+;  With MPCTEMP replace M303 with 'M306 T' to tune MPC.
+;
+M104 S200          ; Step from room temperature
+G4 S240
+M104 S230          ; Small step up
+G4 S180
+M106 S255          ; Fan load, counted in the 230C step's settling time
+G4 S120
+M107
+M303 E0 S220 C8 U1 ; Tune PID and use the result
+M104 S200
+G4 S240
+M303 E-1 S60 C8 U1 ; Tune the bed, let it cool, then step it
+M140 S0
+G4 S300
+M190 S60
+G4 S120
+M104 S0
+M140 S0